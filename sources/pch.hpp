@@ -22,6 +22,7 @@
 #include <functional>
 #include <initializer_list>
 #include <optional>
+#include <expected>
 #include <source_location>
 #include <tuple>
 #include <type_traits>
@@ -5,10 +5,30 @@
 ///////////////////////////////////////////////////////////////////////////
 
 #include <xrn/Util/Clock.hpp>
+#include <xrn/Util/ClockSource.hpp>
 #include <xrn/Util/Time.hpp>
+#include <xrn/Util/TimerStats.hpp>
+#include <xrn/Util/ScopedTimer.hpp>
 #include <xrn/Util/Id.hpp>
 #include <xrn/Util/OptionalReference.hpp>
 #include <xrn/Util/File.hpp>
+#include <xrn/Util/FileDescriptor.hpp>
+#include <xrn/Util/ByteScanner.hpp>
+#include <xrn/Util/MappedFile.hpp>
+#include <xrn/Util/AlignedBuffer.hpp>
+#include <xrn/Util/LineReader.hpp>
+#include <xrn/Util/LineTable.hpp>
+#include <xrn/Util/LineIndex.hpp>
+#include <xrn/Util/CsvReader.hpp>
+#include <xrn/Util/ChunkReader.hpp>
+#include <xrn/Util/DecompressingReader.hpp>
+#include <xrn/Util/FileWriter.hpp>
+#include <xrn/Util/IoUring.hpp>
+#include <xrn/Util/BatchReader.hpp>
+#include <xrn/Util/FileCache.hpp>
+#include <xrn/Util/FileWatcher.hpp>
+#include <xrn/Util/FileFollower.hpp>
+#include <xrn/Util/DirectoryScanner.hpp>
 #include <xrn/Util/Constraint.hpp>
 #include <xrn/Util/Random.hpp>
 #include <xrn/Util/SyncedThreads.hpp>
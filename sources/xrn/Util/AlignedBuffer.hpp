@@ -0,0 +1,265 @@
+#pragma once
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Aligned and padded block of bytes
+/// \ingroup util
+///
+/// \include AlignedBuffer.hpp <xrn/Util/AlignedBuffer.hpp>
+///
+/// ::xrn::util::AlignedBuffer starts on an alignment boundary and is
+/// followed by at least alignment bytes of zeroed padding, so SIMD code can
+/// use aligned loads and read whole vectors past the last byte without
+/// handling the tail separately.
+/// The class is move-only and is usually created by
+/// ::xrn::util::File::getBinary().
+///
+/// Usage example:
+/// \code
+/// auto buffer{ ::xrn::File::getBinary("filepath", 32) };
+/// for (auto i{ 0uz }; i < buffer.size(); i += 32) {
+///     auto vector{ ::_mm256_load_si256(reinterpret_cast<const __m256i*>(buffer.data() + i)) };
+/// }
+/// \endcode
+///
+/// \see ::xrn::util::File
+///
+///////////////////////////////////////////////////////////////////////////
+class AlignedBuffer {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default alignment, the size of a cache line and of an AVX-512
+    ///        register
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ::std::size_t defaultAlignment{ 64 };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructs an empty buffer without any allocation
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit AlignedBuffer() noexcept = default;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Allocates size bytes followed by the padding
+    ///
+    /// The content is not initialized, the padding is zeroed.
+    ///
+    /// \param size Amount of bytes
+    /// \param alignment Alignment of the first byte, rounded up to a power
+    ///        of two
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline AlignedBuffer(
+        ::std::size_t size
+        , ::std::size_t alignment = AlignedBuffer::defaultAlignment
+    );
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Rule of 5
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline ~AlignedBuffer();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy constructor deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    AlignedBuffer(
+        const AlignedBuffer& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        const AlignedBuffer& that
+    ) noexcept
+        -> AlignedBuffer& = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline AlignedBuffer(
+        AlignedBuffer&& that
+    ) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move assign operator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto operator=(
+        AlignedBuffer&& that
+    ) noexcept
+        -> AlignedBuffer&;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Changes the size, keeping the content and the alignment
+    ///
+    /// Reallocates only if the padding does not fit anymore. Added bytes
+    /// are not initialized, the padding is zeroed again.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void resize(
+        ::std::size_t size
+    );
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Content as characters
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getView() const noexcept
+        -> ::std::string_view;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Content as bytes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getBytes() const noexcept
+        -> ::std::span<const ::std::byte>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Pointer to the first byte, aligned on getAlignment()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto data() noexcept
+        -> ::std::byte*;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Pointer to the first byte, aligned on getAlignment()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto data() const noexcept
+        -> const ::std::byte*;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of bytes of content
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto size() const noexcept
+        -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the buffer contains no bytes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto empty() const noexcept
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Alignment of the first byte
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getAlignment() const noexcept
+        -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of zeroed bytes readable after the content, at least
+    ///        getAlignment() unless nothing is allocated
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getPadding() const noexcept
+        -> ::std::size_t;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Frees the allocation if any
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void deallocate() noexcept;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Allocation of m_capacity bytes, nullptr if empty
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::byte* m_data{ nullptr };
+    ::std::size_t m_capacity{ 0 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Content is [0, m_size), [m_size, m_capacity) is zeroed
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::size_t m_size{ 0 };
+    ::std::size_t m_alignment{ AlignedBuffer::defaultAlignment };
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using AlignedBuffer = ::xrn::util::AlignedBuffer; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/AlignedBuffer.impl.hpp>
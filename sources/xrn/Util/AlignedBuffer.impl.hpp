@@ -0,0 +1,174 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::AlignedBuffer::AlignedBuffer(
+    ::std::size_t size
+    , ::std::size_t alignment
+)
+    : m_alignment{ ::std::bit_ceil(::std::max(alignment, 1uz)) }
+{
+    this->resize(size);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Rule of 5
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::AlignedBuffer::~AlignedBuffer()
+{
+    this->deallocate();
+}
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::AlignedBuffer::AlignedBuffer(
+    AlignedBuffer&& that
+) noexcept
+    : m_data{ ::std::exchange(that.m_data, nullptr) }
+    , m_capacity{ ::std::exchange(that.m_capacity, 0) }
+    , m_size{ ::std::exchange(that.m_size, 0) }
+    , m_alignment{ that.m_alignment }
+{}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::AlignedBuffer::operator=(
+    AlignedBuffer&& that
+) noexcept
+    -> AlignedBuffer&
+{
+    if (this != &that) {
+        this->deallocate();
+        m_data = ::std::exchange(that.m_data, nullptr);
+        m_capacity = ::std::exchange(that.m_capacity, 0);
+        m_size = ::std::exchange(that.m_size, 0);
+        m_alignment = that.m_alignment;
+    }
+    return *this;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::AlignedBuffer::resize(
+    ::std::size_t size
+)
+{
+    if (!m_data || size + m_alignment > m_capacity) {
+        // rounded up so the padding always ends on an alignment boundary
+        const auto capacity{ ::std::max(
+            (size + m_alignment - 1) / m_alignment * m_alignment + m_alignment
+            , m_capacity * 2
+        ) };
+        auto* data{ static_cast<::std::byte*>(::operator new(capacity, ::std::align_val_t{ m_alignment })) };
+        if (m_data) {
+            ::std::memcpy(data, m_data, ::std::min(m_size, size));
+            this->deallocate();
+        }
+        m_data = data;
+        m_capacity = capacity;
+    }
+    m_size = size;
+    ::std::memset(m_data + m_size, 0, m_capacity - m_size);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Getters
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::AlignedBuffer::getView() const noexcept
+    -> ::std::string_view
+{
+    return ::std::string_view{ reinterpret_cast<const char*>(m_data), m_size };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::AlignedBuffer::getBytes() const noexcept
+    -> ::std::span<const ::std::byte>
+{
+    return ::std::span<const ::std::byte>{ m_data, m_size };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::AlignedBuffer::data() noexcept
+    -> ::std::byte*
+{
+    return m_data;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::AlignedBuffer::data() const noexcept
+    -> const ::std::byte*
+{
+    return m_data;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::AlignedBuffer::size() const noexcept
+    -> ::std::size_t
+{
+    return m_size;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::AlignedBuffer::empty() const noexcept
+    -> bool
+{
+    return m_size == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::AlignedBuffer::getAlignment() const noexcept
+    -> ::std::size_t
+{
+    return m_alignment;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::AlignedBuffer::getPadding() const noexcept
+    -> ::std::size_t
+{
+    return m_capacity - m_size;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::AlignedBuffer::deallocate() noexcept
+{
+    if (m_data) {
+        ::operator delete(m_data, ::std::align_val_t{ m_alignment });
+        m_data = nullptr;
+    }
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/FileDescriptor.hpp>
+#include <xrn/Util/IoUring.hpp>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Reads many files at once
+/// \ingroup util
+///
+/// \include BatchReader.hpp <xrn/Util/BatchReader.hpp>
+///
+/// ::xrn::util::BatchReader loads the whole content of many files while
+/// keeping up to queueDepth reads in flight. Reads are submitted in batches
+/// through io_uring, when it is not available (old kernel, kernel without
+/// IORING_OP_READ, seccomp, ...) a pool of worker threads is used instead.
+/// Files are opened on the calling thread, only the reads are asynchronous.
+/// Results are handed to a callback as soon as each file is complete, in
+/// any order. The callback is never called concurrently.
+/// It is usually used through ::xrn::util::File::loadMany().
+///
+/// Usage example:
+/// \code
+/// ::xrn::BatchReader reader;
+/// reader.read(filenames, [](::std::size_t index, ::std::string content, ::std::error_code error){
+///     ...
+/// });
+/// \endcode
+///
+/// \see ::xrn::util::File
+///
+///////////////////////////////////////////////////////////////////////////
+class BatchReader {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default amount of reads in flight
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr unsigned defaultQueueDepth{ 128 };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sets up io_uring or prepares the thread pool fallback
+    ///
+    /// \param queueDepth Amount of reads in flight with io_uring
+    /// \param threadCount Amount of workers of the fallback, 0 uses one
+    ///        thread per hardware thread
+    /// \param isIoUringAllowed False always uses the thread pool
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline BatchReader(
+        unsigned queueDepth = BatchReader::defaultQueueDepth
+        , ::std::size_t threadCount = 0
+        , bool isIoUringAllowed = true
+    );
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads every file and returns once all of them are done
+    ///
+    /// callback is called once per file with its index in filenames, its
+    /// content and an error code (the content is empty on error).
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void read(
+        ::std::span<const ::std::string> filenames
+        , auto&& callback
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether reads go through io_uring
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto isUsingIoUring() const noexcept
+        -> bool;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief io_uring implementation of read()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void readWithIoUring(
+        ::std::span<const ::std::string> filenames
+        , auto& callback
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Thread pool implementation of read()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void readWithThreads(
+        ::std::span<const ::std::string> filenames
+        , auto& callback
+    );
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // io_uring instance, nullptr if not available
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::unique_ptr<::xrn::util::IoUring> m_ring;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Amount of workers of the fallback
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::size_t m_threadCount;
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using BatchReader = ::xrn::util::BatchReader; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/BatchReader.impl.hpp>
@@ -0,0 +1,232 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::BatchReader::BatchReader(
+    unsigned queueDepth
+    , ::std::size_t threadCount
+    , bool isIoUringAllowed
+)
+    : m_threadCount{ threadCount ? threadCount : ::std::max(::std::thread::hardware_concurrency(), 1u) }
+{
+    if (!isIoUringAllowed) {
+        return;
+    }
+    try {
+        m_ring = ::std::make_unique<::xrn::util::IoUring>(::std::max(queueDepth, 1u));
+    } catch (const ::std::system_error&) {
+        return; // falls back to threads
+    }
+    // io_uring without IORING_OP_READ (5.1 to 5.5) fails every read
+    if (!m_ring->isSupported(IORING_OP_READ)) {
+        m_ring.reset();
+    }
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::BatchReader::read(
+    ::std::span<const ::std::string> filenames
+    , auto&& callback
+)
+{
+    if (m_ring) {
+        this->readWithIoUring(filenames, callback);
+    } else {
+        this->readWithThreads(filenames, callback);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::BatchReader::isUsingIoUring() const noexcept
+    -> bool
+{
+    return m_ring != nullptr;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::BatchReader::readWithIoUring(
+    ::std::span<const ::std::string> filenames
+    , auto& callback
+)
+{
+    // a single read is limited to what fits in the length of a request
+    constexpr ::std::size_t maxReadSize{ 1uz << 30 };
+
+    struct Request {
+        ::xrn::util::FileDescriptor fd;
+        ::std::string content;
+        ::std::size_t amountRead{ 0 };
+    };
+    ::std::vector<Request> requests(filenames.size());
+    ::std::size_t next{ 0 };
+    ::std::size_t inFlight{ 0 };
+
+    // the kernel writes into the buffers until the reads complete, so they
+    // must outlive every read in flight, even when leaving on an exception
+    struct Drain {
+        ::xrn::util::IoUring& ring;
+        ::std::vector<Request>& requests;
+        ::std::size_t& inFlight;
+        ~Drain()
+        {
+            try {
+                while (inFlight) {
+                    ring.submit(1);
+                    inFlight -= ring.forEachCompletion([](::std::uint64_t, int){});
+                }
+            } catch (const ::std::system_error&) {
+                // cannot be waited for, the buffers are leaked rather than freed
+                new ::std::vector<Request>{ ::std::move(requests) };
+            }
+        }
+    } drain{ *m_ring, requests, inFlight };
+
+    const auto finish{ [&](::std::size_t index, ::std::error_code error){
+        auto& request{ requests[index] };
+        request.fd.close();
+        if (error) {
+            request.content.clear();
+        } else {
+            request.content.resize(request.amountRead);
+        }
+        callback(index, ::std::move(request.content), error);
+        request.content = {};
+    } };
+    const auto queueRead{ [&](::std::size_t index){
+        auto& request{ requests[index] };
+        const auto prepare{ [&]{
+            return m_ring->prepareRead(
+                request.fd.get()
+                , request.content.data() + request.amountRead
+                , static_cast<unsigned>(::std::min(request.content.size() - request.amountRead, maxReadSize))
+                , request.amountRead
+                , index
+            );
+        } };
+        // submission queue full, the requests queued are handed to the kernel
+        // to free their entries
+        if (!prepare()) {
+            m_ring->submit();
+            if (!prepare()) {
+                throw ::std::system_error{ EBUSY, ::std::generic_category(), "io_uring submission queue" };
+            }
+        }
+        ++inFlight;
+    } };
+
+    while (next < filenames.size() || inFlight) {
+        while (next < filenames.size() && inFlight < m_ring->getCapacity()) {
+            const auto index{ next++ };
+            auto& request{ requests[index] };
+            try {
+                request.fd = ::xrn::util::FileDescriptor{ filenames[index], O_RDONLY };
+                const auto size{ request.fd.getSize() };
+                if (size == 0) {
+                    // size unknown (procfs, ...) or empty, not worth a ring slot
+                    request.fd.readAll(request.content);
+                    request.amountRead = request.content.size();
+                    finish(index, {});
+                    continue;
+                }
+                request.content.resize(size);
+            } catch (const ::std::system_error& error) {
+                finish(index, error.code());
+                continue;
+            }
+            queueRead(index);
+        }
+
+        if (!inFlight) {
+            continue;
+        }
+        m_ring->submit(1);
+        m_ring->forEachCompletion([&](::std::uint64_t userData, int result){
+            const auto index{ static_cast<::std::size_t>(userData) };
+            auto& request{ requests[index] };
+            --inFlight;
+            if (result == -EINTR || result == -EAGAIN) {
+                queueRead(index);
+            } else if (result < 0) {
+                finish(index, ::std::error_code{ -result, ::std::generic_category() });
+            } else if (result == 0) {
+                finish(index, {}); // truncated while reading
+            } else {
+                request.amountRead += static_cast<::std::size_t>(result);
+                if (request.amountRead < request.content.size()) {
+                    queueRead(index);
+                } else {
+                    finish(index, {});
+                }
+            }
+        });
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::BatchReader::readWithThreads(
+    ::std::span<const ::std::string> filenames
+    , auto& callback
+)
+{
+    ::std::atomic<::std::size_t> next{ 0 };
+    ::std::mutex callbackMutex;
+    ::std::exception_ptr callbackException;
+    ::std::vector<::std::jthread> workers;
+    const auto workerCount{ ::std::min(m_threadCount, filenames.size()) };
+    workers.reserve(workerCount);
+
+    for (auto i{ 0uz }; i < workerCount; ++i) {
+        workers.emplace_back([&]{
+            for (auto index{ next++ }; index < filenames.size(); index = next++) {
+                ::std::string content;
+                ::std::error_code error;
+                try {
+                    ::xrn::util::FileDescriptor{ filenames[index], O_RDONLY }.readAll(content);
+                } catch (const ::std::system_error& exception) {
+                    error = exception.code();
+                    content.clear();
+                }
+                ::std::scoped_lock lock{ callbackMutex };
+                if (callbackException) {
+                    return;
+                }
+                // stops the other workers and is thrown again once they are done
+                try {
+                    callback(index, ::std::move(content), error);
+                } catch (...) {
+                    callbackException = ::std::current_exception();
+                    next = filenames.size();
+                    return;
+                }
+            }
+        });
+    }
+    workers.clear();
+    if (callbackException) {
+        ::std::rethrow_exception(callbackException);
+    }
+}
@@ -0,0 +1,280 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define XRN_BYTE_SCANNER_X86
+    #include <immintrin.h>
+#endif // x86
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Vectorized search of bytes in a buffer
+/// \ingroup util
+///
+/// \include ByteScanner.hpp <xrn/Util/ByteScanner.hpp>
+///
+/// ::xrn::util::ByteScanner looks for delimiter bytes (usually '\n') in a
+/// buffer 32 (AVX2) or 16 (SSE2) bytes at a time. The instruction set is
+/// detected once at runtime, a scalar fallback is used on other
+/// architectures. It is the building block of every line and record API of
+/// ::xrn::util::File.
+/// forEach() reports every occurrence of a byte from bitmasks, which is much
+/// faster than calling find() repeatedly when occurrences are dense (short
+/// lines).
+///
+/// Usage example:
+/// \code
+/// auto* newline{ ::xrn::ByteScanner::find(first, last, '\n') };
+/// ::xrn::ByteScanner::forEach(first, last, '\n', [](const char* it){ ... });
+/// \endcode
+///
+/// \see ::xrn::util::File
+///
+///////////////////////////////////////////////////////////////////////////
+class ByteScanner {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Instruction sets the scanner can dispatch to
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Isa : ::std::uint8_t {
+        scalar,
+        sse2,
+        avx2,
+    };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit ByteScanner() = delete;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Dispatch
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Best instruction set supported by the running CPU
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto getSupportedIsa() noexcept
+        -> ByteScanner::Isa;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Instruction set currently used
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto getIsa() noexcept
+        -> ByteScanner::Isa;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Forces the instruction set used, mostly useful for testing
+    ///
+    /// The value is clamped to getSupportedIsa().
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static inline void setIsa(
+        ByteScanner::Isa isa
+    ) noexcept;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief First occurrence of a byte in [first, last)
+    ///
+    /// \return Pointer to the byte found or last if there is none
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto find(
+        const char* first
+        , const char* last
+        , char byte
+    ) noexcept
+        -> const char*;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief First occurrence of any of three bytes in [first, last)
+    ///
+    /// The same byte can be given multiple times to search less than three.
+    ///
+    /// \return Pointer to the byte found or last if there is none
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto findAny(
+        const char* first
+        , const char* last
+        , char byte1
+        , char byte2
+        , char byte3
+    ) noexcept
+        -> const char*;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Calls callback with a pointer to each occurrence of a byte in
+    ///        [first, last), in order
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void forEach(
+        const char* first
+        , const char* last
+        , char byte
+        , auto&& callback
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of occurrences of a byte in [first, last)
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto count(
+        const char* first
+        , const char* last
+        , char byte
+    ) noexcept
+        -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Removes the '\r' of a "\r\n" line ending from a line that was
+    ///        split on '\n'
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static constexpr auto trimCarriageReturn(
+        ::std::string_view line
+    ) noexcept
+        -> ::std::string_view;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Implementations
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Instruction set selected, initialized to getSupportedIsa()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto getActiveIsa() noexcept
+        -> ::std::atomic<ByteScanner::Isa>&;
+
+    static inline auto findAnyScalar(
+        const char* first
+        , const char* last
+        , char byte1
+        , char byte2
+        , char byte3
+    ) noexcept
+        -> const char*;
+
+    static void forEachScalar(
+        const char* first
+        , const char* last
+        , char byte
+        , auto& callback
+    );
+
+#ifdef XRN_BYTE_SCANNER_X86
+    __attribute__(( target("sse2") )) static inline auto findSse2(
+        const char* first
+        , const char* last
+        , char byte
+    ) noexcept
+        -> const char*;
+
+    __attribute__(( target("avx2") )) static inline auto findAvx2(
+        const char* first
+        , const char* last
+        , char byte
+    ) noexcept
+        -> const char*;
+
+    __attribute__(( target("sse2") )) static inline auto findAnySse2(
+        const char* first
+        , const char* last
+        , char byte1
+        , char byte2
+        , char byte3
+    ) noexcept
+        -> const char*;
+
+    __attribute__(( target("avx2") )) static inline auto findAnyAvx2(
+        const char* first
+        , const char* last
+        , char byte1
+        , char byte2
+        , char byte3
+    ) noexcept
+        -> const char*;
+
+    __attribute__(( target("sse2") )) static void forEachSse2(
+        const char* first
+        , const char* last
+        , char byte
+        , auto& callback
+    );
+
+    __attribute__(( target("avx2") )) static void forEachAvx2(
+        const char* first
+        , const char* last
+        , char byte
+        , auto& callback
+    );
+#endif // XRN_BYTE_SCANNER_X86
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using ByteScanner = ::xrn::util::ByteScanner; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/ByteScanner.impl.hpp>
@@ -0,0 +1,339 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Dispatch
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ByteScanner::getSupportedIsa() noexcept
+    -> ByteScanner::Isa
+{
+#ifdef XRN_BYTE_SCANNER_X86
+    static const ByteScanner::Isa isa{ []{
+        ::__builtin_cpu_init();
+        if (::__builtin_cpu_supports("avx2")) {
+            return ByteScanner::Isa::avx2;
+        }
+        if (::__builtin_cpu_supports("sse2")) {
+            return ByteScanner::Isa::sse2;
+        }
+        return ByteScanner::Isa::scalar;
+    }() };
+    return isa;
+#else
+    return ByteScanner::Isa::scalar;
+#endif // XRN_BYTE_SCANNER_X86
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ByteScanner::getIsa() noexcept
+    -> ByteScanner::Isa
+{
+    return ByteScanner::getActiveIsa().load(::std::memory_order::relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::ByteScanner::setIsa(
+    ByteScanner::Isa isa
+) noexcept
+{
+    ByteScanner::getActiveIsa().store(
+        ::std::min(isa, ByteScanner::getSupportedIsa())
+        , ::std::memory_order::relaxed
+    );
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ByteScanner::find(
+    const char* first
+    , const char* last
+    , char byte
+) noexcept
+    -> const char*
+{
+    switch (ByteScanner::getIsa()) {
+#ifdef XRN_BYTE_SCANNER_X86
+    case ByteScanner::Isa::avx2: return ByteScanner::findAvx2(first, last, byte);
+    case ByteScanner::Isa::sse2: return ByteScanner::findSse2(first, last, byte);
+#endif // XRN_BYTE_SCANNER_X86
+    default: break;
+    }
+    const auto* it{ ::std::memchr(first, byte, static_cast<::std::size_t>(last - first)) };
+    return it ? static_cast<const char*>(it) : last;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ByteScanner::findAny(
+    const char* first
+    , const char* last
+    , char byte1
+    , char byte2
+    , char byte3
+) noexcept
+    -> const char*
+{
+    switch (ByteScanner::getIsa()) {
+#ifdef XRN_BYTE_SCANNER_X86
+    case ByteScanner::Isa::avx2: return ByteScanner::findAnyAvx2(first, last, byte1, byte2, byte3);
+    case ByteScanner::Isa::sse2: return ByteScanner::findAnySse2(first, last, byte1, byte2, byte3);
+#endif // XRN_BYTE_SCANNER_X86
+    default: return ByteScanner::findAnyScalar(first, last, byte1, byte2, byte3);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::ByteScanner::forEach(
+    const char* first
+    , const char* last
+    , char byte
+    , auto&& callback
+)
+{
+    switch (ByteScanner::getIsa()) {
+#ifdef XRN_BYTE_SCANNER_X86
+    case ByteScanner::Isa::avx2: return ByteScanner::forEachAvx2(first, last, byte, callback);
+    case ByteScanner::Isa::sse2: return ByteScanner::forEachSse2(first, last, byte, callback);
+#endif // XRN_BYTE_SCANNER_X86
+    default: return ByteScanner::forEachScalar(first, last, byte, callback);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ByteScanner::count(
+    const char* first
+    , const char* last
+    , char byte
+) noexcept
+    -> ::std::size_t
+{
+    ::std::size_t amount{ 0 };
+    ByteScanner::forEach(first, last, byte, [&amount](const char*){ ++amount; });
+    return amount;
+}
+
+///////////////////////////////////////////////////////////////////////////
+constexpr auto ::xrn::util::ByteScanner::trimCarriageReturn(
+    ::std::string_view line
+) noexcept
+    -> ::std::string_view
+{
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+    return line;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Implementations
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ByteScanner::getActiveIsa() noexcept
+    -> ::std::atomic<ByteScanner::Isa>&
+{
+    static ::std::atomic<ByteScanner::Isa> isa{ ByteScanner::getSupportedIsa() };
+    return isa;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ByteScanner::findAnyScalar(
+    const char* first
+    , const char* last
+    , char byte1
+    , char byte2
+    , char byte3
+) noexcept
+    -> const char*
+{
+    for (; first != last; ++first) {
+        if (*first == byte1 || *first == byte2 || *first == byte3) {
+            return first;
+        }
+    }
+    return last;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::ByteScanner::forEachScalar(
+    const char* first
+    , const char* last
+    , char byte
+    , auto& callback
+)
+{
+    while (first != last) {
+        const auto* it{ static_cast<const char*>(
+            ::std::memchr(first, byte, static_cast<::std::size_t>(last - first))
+        ) };
+        if (!it) {
+            return;
+        }
+        callback(it);
+        first = it + 1;
+    }
+}
+
+#ifdef XRN_BYTE_SCANNER_X86
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ByteScanner::findSse2(
+    const char* first
+    , const char* last
+    , char byte
+) noexcept
+    -> const char*
+{
+    const auto needle{ ::_mm_set1_epi8(byte) };
+    for (; last - first >= 16; first += 16) {
+        const auto chunk{ ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)) };
+        const auto mask{ static_cast<::std::uint32_t>(
+            ::_mm_movemask_epi8(::_mm_cmpeq_epi8(chunk, needle))
+        ) };
+        if (mask) {
+            return first + ::std::countr_zero(mask);
+        }
+    }
+    return ByteScanner::findAnyScalar(first, last, byte, byte, byte);
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ByteScanner::findAvx2(
+    const char* first
+    , const char* last
+    , char byte
+) noexcept
+    -> const char*
+{
+    const auto needle{ ::_mm256_set1_epi8(byte) };
+    for (; last - first >= 32; first += 32) {
+        const auto chunk{ ::_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)) };
+        const auto mask{ static_cast<::std::uint32_t>(
+            ::_mm256_movemask_epi8(::_mm256_cmpeq_epi8(chunk, needle))
+        ) };
+        if (mask) {
+            return first + ::std::countr_zero(mask);
+        }
+    }
+    return ByteScanner::findSse2(first, last, byte);
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ByteScanner::findAnySse2(
+    const char* first
+    , const char* last
+    , char byte1
+    , char byte2
+    , char byte3
+) noexcept
+    -> const char*
+{
+    const auto needle1{ ::_mm_set1_epi8(byte1) };
+    const auto needle2{ ::_mm_set1_epi8(byte2) };
+    const auto needle3{ ::_mm_set1_epi8(byte3) };
+    for (; last - first >= 16; first += 16) {
+        const auto chunk{ ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)) };
+        const auto matches{ ::_mm_or_si128(
+            ::_mm_or_si128(::_mm_cmpeq_epi8(chunk, needle1), ::_mm_cmpeq_epi8(chunk, needle2))
+            , ::_mm_cmpeq_epi8(chunk, needle3)
+        ) };
+        const auto mask{ static_cast<::std::uint32_t>(::_mm_movemask_epi8(matches)) };
+        if (mask) {
+            return first + ::std::countr_zero(mask);
+        }
+    }
+    return ByteScanner::findAnyScalar(first, last, byte1, byte2, byte3);
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ByteScanner::findAnyAvx2(
+    const char* first
+    , const char* last
+    , char byte1
+    , char byte2
+    , char byte3
+) noexcept
+    -> const char*
+{
+    const auto needle1{ ::_mm256_set1_epi8(byte1) };
+    const auto needle2{ ::_mm256_set1_epi8(byte2) };
+    const auto needle3{ ::_mm256_set1_epi8(byte3) };
+    for (; last - first >= 32; first += 32) {
+        const auto chunk{ ::_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)) };
+        const auto matches{ ::_mm256_or_si256(
+            ::_mm256_or_si256(::_mm256_cmpeq_epi8(chunk, needle1), ::_mm256_cmpeq_epi8(chunk, needle2))
+            , ::_mm256_cmpeq_epi8(chunk, needle3)
+        ) };
+        const auto mask{ static_cast<::std::uint32_t>(::_mm256_movemask_epi8(matches)) };
+        if (mask) {
+            return first + ::std::countr_zero(mask);
+        }
+    }
+    return ByteScanner::findAnySse2(first, last, byte1, byte2, byte3);
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::ByteScanner::forEachSse2(
+    const char* first
+    , const char* last
+    , char byte
+    , auto& callback
+)
+{
+    const auto needle{ ::_mm_set1_epi8(byte) };
+    for (; last - first >= 16; first += 16) {
+        const auto chunk{ ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)) };
+        auto mask{ static_cast<::std::uint32_t>(::_mm_movemask_epi8(::_mm_cmpeq_epi8(chunk, needle))) };
+        while (mask) {
+            callback(first + ::std::countr_zero(mask));
+            mask &= mask - 1;
+        }
+    }
+    ByteScanner::forEachScalar(first, last, byte, callback);
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::ByteScanner::forEachAvx2(
+    const char* first
+    , const char* last
+    , char byte
+    , auto& callback
+)
+{
+    const auto needle{ ::_mm256_set1_epi8(byte) };
+    for (; last - first >= 64; first += 64) {
+        const auto low{ ::_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)) };
+        const auto high{ ::_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + 32)) };
+        auto mask{
+            static_cast<::std::uint64_t>(static_cast<::std::uint32_t>(
+                ::_mm256_movemask_epi8(::_mm256_cmpeq_epi8(low, needle))
+            ))
+            | static_cast<::std::uint64_t>(static_cast<::std::uint32_t>(
+                ::_mm256_movemask_epi8(::_mm256_cmpeq_epi8(high, needle))
+            )) << 32
+        };
+        while (mask) {
+            callback(first + ::std::countr_zero(mask));
+            mask &= mask - 1;
+        }
+    }
+    ByteScanner::forEachSse2(first, last, byte, callback);
+}
+
+#endif // XRN_BYTE_SCANNER_X86
@@ -0,0 +1,335 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <fcntl.h>
+#include <xrn/Util/FileDescriptor.hpp>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Reads a file chunk by chunk with a bounded amount of memory
+/// \ingroup util
+///
+/// \include ChunkReader.hpp <xrn/Util/ChunkReader.hpp>
+///
+/// ::xrn::util::ChunkReader walks through a file of any size using two
+/// buffers of chunkSize bytes: while a chunk is processed, the next one is
+/// read in the background by a single thread kept for the whole file.
+/// The kernel is told the file is read sequentially and, unless disabled,
+/// the pages of the chunks already processed are dropped from the page
+/// cache so reading a file bigger than the memory does not evict the
+/// pages of the rest of the system.
+/// Chunks are split at fixed offsets, not on line boundaries.
+///
+/// Usage example:
+/// \code
+/// for (::std::string_view chunk : ::xrn::File::chunks("filepath")) {
+///     ...
+/// }
+/// \endcode
+///
+/// \see ::xrn::util::File
+///
+///////////////////////////////////////////////////////////////////////////
+class ChunkReader {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default size of a chunk in bytes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ::std::size_t defaultChunkSize{ 4 * 1024 * 1024 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Input iterator over the chunks
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Iterator {
+
+    public:
+
+        using value_type = ::std::string_view;
+        using difference_type = ::std::ptrdiff_t;
+        using iterator_concept = ::std::input_iterator_tag;
+
+        Iterator() noexcept = default;
+
+        explicit inline Iterator(
+            ChunkReader& reader
+        ) noexcept;
+
+        [[ nodiscard ]] inline auto operator*() const noexcept
+            -> ::std::string_view;
+
+        inline auto operator++()
+            -> Iterator&;
+
+        inline void operator++(
+            int
+        );
+
+        [[ nodiscard ]] inline auto operator==(
+            ::std::default_sentinel_t
+        ) const noexcept
+            -> bool;
+
+    private:
+
+        ChunkReader* m_reader{ nullptr };
+
+    };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Opens the file, nothing is read until begin() is called
+    ///
+    /// \param filename Path of the file to read
+    /// \param chunkSize Size of a chunk, two of them are allocated
+    /// \param isDroppingCache Whether the pages of the chunks already
+    ///        processed are dropped from the page cache
+    ///
+    /// \throws ::std::system_error if the file cannot be opened
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline ChunkReader(
+        const ::std::string& filename
+        , ::std::size_t chunkSize = ChunkReader::defaultChunkSize
+        , bool isDroppingCache = true
+    );
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Rule of 5
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Stops the background thread once its current read is over and closes
+    /// the file.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline ~ChunkReader();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy constructor deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ChunkReader(
+        const ChunkReader& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        const ChunkReader& that
+    ) noexcept
+        -> ChunkReader& = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move constructor deleted, the background read refers to the
+    ///        reader
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ChunkReader(
+        ChunkReader&& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        ChunkReader&& that
+    ) noexcept
+        -> ChunkReader& = delete;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Range
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads the first chunk and returns an iterator on it
+    ///
+    /// The range is single pass: calling begin() again continues from the
+    /// current chunk.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto begin()
+        -> ChunkReader::Iterator;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sentinel marking the end of the file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto end() const noexcept
+        -> ::std::default_sentinel_t;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Moves to the next chunk and starts reading the one after it
+    ///
+    /// The previous chunk is invalidated.
+    ///
+    /// \return False if the end of the file is reached
+    ///
+    /// \throws ::std::system_error if reading fails, the reader is then at
+    ///         its end
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto next()
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Chunk read by the last call to next()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getChunk() const noexcept
+        -> ::std::string_view;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Position of the current chunk in the file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getOffset() const noexcept
+        -> ::std::size_t;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Starts reading the chunk following the current one into the
+    ///        back buffer
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void prefetch();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Waits for the chunk requested by prefetch()
+    ///
+    /// \return Amount of bytes read into the back buffer
+    ///
+    /// \throws The exception thrown by the read, if any
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto waitPrefetch()
+        -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Body of the prefetching thread, serves the requests until
+    ///        stopped
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void runPrefetcher(
+        ::std::stop_token stopToken
+    );
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // File read
+    ///////////////////////////////////////////////////////////////////////////
+    ::xrn::util::FileDescriptor m_fd;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Current chunk lives in m_front, the next one is read in m_back
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::size_t m_chunkSize;
+    ::std::unique_ptr<char[]> m_front;
+    ::std::unique_ptr<char[]> m_back;
+    ::std::string_view m_chunk;
+    ::std::size_t m_offset{ 0 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // State of the range
+    ///////////////////////////////////////////////////////////////////////////
+    bool m_isDroppingCache;
+    bool m_isStarted{ false };
+    bool m_isDone{ false };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Request to the prefetching thread and its result: m_isRequested is set
+    // by prefetch(), m_isPrefetched once m_prefetched or m_exception is set
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::mutex m_mutex;
+    ::std::condition_variable_any m_condition;
+    bool m_isRequested{ false };
+    bool m_isPrefetched{ false };
+    ::std::size_t m_prefetched{ 0 };
+    ::std::exception_ptr m_exception;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Background reads of m_back, started with the first prefetch and kept
+    // for the whole file. Declared last to be joined before the buffers are
+    // destroyed
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::jthread m_prefetcher;
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using ChunkReader = ::xrn::util::ChunkReader; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/ChunkReader.impl.hpp>
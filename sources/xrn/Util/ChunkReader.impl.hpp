@@ -0,0 +1,257 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Iterator
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::ChunkReader::Iterator::Iterator(
+    ChunkReader& reader
+) noexcept
+    : m_reader{ &reader }
+{}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ChunkReader::Iterator::operator*() const noexcept
+    -> ::std::string_view
+{
+    return m_reader->getChunk();
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ChunkReader::Iterator::operator++()
+    -> Iterator&
+{
+    m_reader->next();
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::ChunkReader::Iterator::operator++(
+    int
+)
+{
+    ++*this;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ChunkReader::Iterator::operator==(
+    ::std::default_sentinel_t
+) const noexcept
+    -> bool
+{
+    return !m_reader || m_reader->m_isDone;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::ChunkReader::ChunkReader(
+    const ::std::string& filename
+    , ::std::size_t chunkSize
+    , bool isDroppingCache
+)
+    : m_fd{ filename, O_RDONLY }
+    , m_chunkSize{ ::std::max(chunkSize, 1uz) }
+    , m_front{ ::std::make_unique_for_overwrite<char[]>(m_chunkSize) }
+    , m_back{ ::std::make_unique_for_overwrite<char[]>(m_chunkSize) }
+    , m_isDroppingCache{ isDroppingCache }
+{
+    // only a hint, failing is harmless
+    ::posix_fadvise(m_fd.get(), 0, 0, POSIX_FADV_SEQUENTIAL);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Rule of 5
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::ChunkReader::~ChunkReader()
+{
+    if (m_prefetcher.joinable()) {
+        m_prefetcher.request_stop();
+        m_prefetcher.join();
+    }
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Range
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ChunkReader::begin()
+    -> ChunkReader::Iterator
+{
+    if (!m_isStarted) {
+        this->next();
+    }
+    return ChunkReader::Iterator{ *this };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ChunkReader::end() const noexcept
+    -> ::std::default_sentinel_t
+{
+    return ::std::default_sentinel;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ChunkReader::next()
+    -> bool
+{
+    if (m_isDone) {
+        return false;
+    }
+
+    ::std::size_t amount;
+    try {
+        if (!m_isStarted) {
+            m_isStarted = true;
+            amount = m_fd.readAt(m_back.get(), m_chunkSize, 0);
+        } else {
+            amount = this->waitPrefetch();
+        }
+    } catch (...) {
+        // nothing is left to wait for, the following calls end the range
+        m_isDone = true;
+        m_chunk = {};
+        throw;
+    }
+    if (m_isDroppingCache && !m_chunk.empty()) {
+        ::posix_fadvise(
+            m_fd.get()
+            , static_cast<::off_t>(m_offset)
+            , static_cast<::off_t>(m_chunk.size())
+            , POSIX_FADV_DONTNEED
+        );
+    }
+    m_offset += m_chunk.size();
+
+    ::std::swap(m_front, m_back);
+    m_chunk = { m_front.get(), amount };
+    if (amount == 0) {
+        m_isDone = true;
+        return false;
+    }
+    this->prefetch();
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ChunkReader::getChunk() const noexcept
+    -> ::std::string_view
+{
+    return m_chunk;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ChunkReader::getOffset() const noexcept
+    -> ::std::size_t
+{
+    return m_offset;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::ChunkReader::prefetch()
+{
+    // a short chunk is the last one, a read would only return 0
+    if (m_chunk.size() < m_chunkSize) {
+        m_prefetched = 0;
+        m_isPrefetched = true;
+        return;
+    }
+    if (!m_prefetcher.joinable()) {
+        m_prefetcher = ::std::jthread{ [this](::std::stop_token stopToken){
+            this->runPrefetcher(stopToken);
+        } };
+    }
+    {
+        ::std::scoped_lock lock{ m_mutex };
+        m_isRequested = true;
+    }
+    m_condition.notify_one();
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::ChunkReader::waitPrefetch()
+    -> ::std::size_t
+{
+    ::std::unique_lock lock{ m_mutex };
+    m_condition.wait(lock, [this]{ return m_isPrefetched; });
+    m_isPrefetched = false;
+    if (m_exception) {
+        ::std::rethrow_exception(::std::exchange(m_exception, nullptr));
+    }
+    return m_prefetched;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::ChunkReader::runPrefetcher(
+    ::std::stop_token stopToken
+)
+{
+    while (true) {
+        ::std::unique_lock lock{ m_mutex };
+        if (!m_condition.wait(lock, stopToken, [this]{ return m_isRequested; })) {
+            return;
+        }
+        m_isRequested = false;
+        // the buffers and the offset only change once the result is taken
+        auto* buffer{ m_back.get() };
+        const auto offset{ m_offset + m_chunk.size() };
+        lock.unlock();
+
+        ::std::size_t amount{ 0 };
+        ::std::exception_ptr exception;
+        try {
+            amount = m_fd.readAt(buffer, m_chunkSize, offset);
+        } catch (...) {
+            exception = ::std::current_exception();
+        }
+
+        lock.lock();
+        m_prefetched = amount;
+        m_exception = ::std::move(exception);
+        m_isPrefetched = true;
+        lock.unlock();
+        m_condition.notify_one();
+    }
+}
@@ -4,6 +4,7 @@
 // Headers
 ///////////////////////////////////////////////////////////////////////////
 #include <xrn/Util/Time.hpp>
+#include <xrn/Util/ClockSource.hpp>
 
 
 
@@ -17,6 +18,14 @@ namespace xrn::util {
 ///
 /// ::xrn::util::BasicClock provide an high resolution clock allowing precise
 /// elapsed time measures.
+/// The time is read from Source, any type meeting the requirements of the
+/// standard clocks (such as ::std::chrono::steady_clock). Where a sample
+/// must be as cheap as possible, ::xrn::util::clockSource::Tsc reads the
+/// time stamp counter of the CPU, it is aliased by ::xrn::TscClock.
+/// ::xrn::util::clockSource also provides coarse, raw and per-thread CPU
+/// time clocks and a manually advanced one for tests.
+/// With ::xrn::NanoTime (aliased by ::xrn::NanoClock), the elapsed time is
+/// kept as integral nanoseconds, exact whatever the uptime.
 ///
 /// Usage example:
 /// \code
@@ -27,11 +36,12 @@ namespace xrn::util {
 /// ::xrn::Time time2{ clock.restart() };
 /// \endcode
 ///
-/// \see ::xrn::util::BasicTime
+/// \see ::xrn::util::BasicTime, ::xrn::util::clockSource::Tsc
 ///
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
+    , typename Source = ::std::chrono::high_resolution_clock
 > class BasicClock {
 
 public:
@@ -49,6 +59,12 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     using Type = T;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Clock the time is read from
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using SourceType = Source;
+
 
 
 public:
@@ -101,7 +117,7 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     [[ nodiscard ]] auto getElapsed()
-        -> BasicClock<T>::Type;
+        -> BasicClock::Type;
 
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Fusion between getElapsed() and reset()
@@ -113,7 +129,7 @@ public:
     ///
     ///////////////////////////////////////////////////////////////////////////
     [[ nodiscard ]] auto restart()
-        -> BasicClock<T>::Type;
+        -> BasicClock::Type;
 
 
 
@@ -122,7 +138,7 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     // Time of the last clock reset (constructor, restart() or reset())
     ///////////////////////////////////////////////////////////////////////////
-    ::std::chrono::time_point<std::chrono::high_resolution_clock> m_timePoint;
+    typename Source::time_point m_timePoint;
 
 };
 
@@ -134,7 +150,19 @@ private:
 // Template specialization
 ///////////////////////////////////////////////////////////////////////////
 namespace xrn::util { using Clock = ::xrn::util::BasicClock<::xrn::Time>; }
+namespace xrn::util { using NanoClock = ::xrn::util::BasicClock<::xrn::NanoTime>; }
+namespace xrn::util { using TscClock = ::xrn::util::BasicClock<::xrn::Time, ::xrn::util::clockSource::Tsc>; }
+namespace xrn::util { using SteadyClock = ::xrn::util::BasicClock<::xrn::Time, ::xrn::util::clockSource::Steady>; }
+namespace xrn::util { using CoarseClock = ::xrn::util::BasicClock<::xrn::Time, ::xrn::util::clockSource::MonotonicCoarse>; }
+namespace xrn::util { using RawClock = ::xrn::util::BasicClock<::xrn::Time, ::xrn::util::clockSource::MonotonicRaw>; }
+namespace xrn::util { using ThreadCpuClock = ::xrn::util::BasicClock<::xrn::Time, ::xrn::util::clockSource::ThreadCpuTime>; }
 namespace xrn { using Clock = ::xrn::util::Clock; }
+namespace xrn { using NanoClock = ::xrn::util::NanoClock; }
+namespace xrn { using TscClock = ::xrn::util::TscClock; }
+namespace xrn { using SteadyClock = ::xrn::util::SteadyClock; }
+namespace xrn { using CoarseClock = ::xrn::util::CoarseClock; }
+namespace xrn { using RawClock = ::xrn::util::RawClock; }
+namespace xrn { using ThreadCpuClock = ::xrn::util::ThreadCpuClock; }
 
 
 
@@ -10,8 +10,9 @@
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> ::xrn::util::BasicClock<T>::BasicClock() noexcept
-    : m_timePoint{ ::std::chrono::high_resolution_clock::now() }
+    , typename Source
+> ::xrn::util::BasicClock<T, Source>::BasicClock() noexcept
+    : m_timePoint{ Source::now() }
 {}
 
 
@@ -26,29 +27,30 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> void ::xrn::util::BasicClock<T>::reset()
+    , typename Source
+> void ::xrn::util::BasicClock<T, Source>::reset()
 {
-    m_timePoint = ::std::chrono::high_resolution_clock::now();
+    m_timePoint = Source::now();
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> auto ::xrn::util::BasicClock<T>::getElapsed()
+    , typename Source
+> auto ::xrn::util::BasicClock<T, Source>::getElapsed()
     -> BasicClock::Type
 {
-    const typename BasicClock::Type::Type second{ 1000 };
-    return BasicClock::Type{ static_cast<typename BasicClock::Type::Type>(
-        ::std::chrono::duration<typename BasicClock::Type::Type>(
-            ::std::chrono::high_resolution_clock::now() - m_timePoint
-        ).count()) * second
-    };
+    // converted once, straight to the unit of the time (no conversion at all
+    // for an integral nanoseconds time with a nanoseconds source)
+    using Duration = ::std::chrono::duration<typename BasicClock::Type::Type, typename BasicClock::Type::Period>;
+    return BasicClock::Type{ ::std::chrono::duration_cast<Duration>(Source::now() - m_timePoint).count() };
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> auto ::xrn::util::BasicClock<T>::restart()
+    , typename Source
+> auto ::xrn::util::BasicClock<T, Source>::restart()
     -> BasicClock::Type
 {
     auto ret{ this->getElapsed() };
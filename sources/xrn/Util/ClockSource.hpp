@@ -0,0 +1,353 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <time.h>
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define XRN_CLOCK_SOURCE_X86
+    #include <x86intrin.h>
+    #include <cpuid.h>
+#endif // x86
+
+
+
+namespace xrn::util::clockSource {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Clock source reading the time stamp counter of the CPU
+/// \ingroup util
+///
+/// \include ClockSource.hpp <xrn/Util/ClockSource.hpp>
+///
+/// ::xrn::util::clockSource::Tsc meets the requirements of the standard
+/// clocks and is meant as the Source of ::xrn::util::BasicClock. A sample is
+/// a single rdtscp instruction followed by a fixed point multiplication,
+/// cheaper than clock_gettime() which also has to read the clock source
+/// parameters shared with the kernel.
+/// The frequency of the counter is calibrated against CLOCK_MONOTONIC the
+/// first time the source is used, which takes calibrationTime. The counter
+/// is only used if the CPU reports an invariant TSC (constant rate and not
+/// stopped in deep sleep states), otherwise every sample falls back to
+/// CLOCK_MONOTONIC.
+///
+/// Usage example:
+/// \code
+/// ::xrn::TscClock clock;
+/// ...
+/// ::xrn::Time time{ clock.getElapsed() };
+/// \endcode
+///
+/// \see ::xrn::util::BasicClock
+///
+///////////////////////////////////////////////////////////////////////////
+class Tsc {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    using rep = ::std::int64_t;
+    using period = ::std::nano;
+    using duration = ::std::chrono::nanoseconds;
+    using time_point = ::std::chrono::time_point<Tsc>;
+    static constexpr bool is_steady{ true };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Time the counter is compared to CLOCK_MONOTONIC to get its
+    ///        frequency
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ::std::chrono::milliseconds calibrationTime{ 10 };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Current time, on the same epoch as CLOCK_MONOTONIC
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto now() noexcept
+        -> Tsc::time_point;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Raw value of the counter, once the previous instructions are
+    ///        done
+    ///
+    /// \return 0 if the CPU has no time stamp counter
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto readTicks() noexcept
+        -> ::std::uint64_t;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the time stamp counter is used, false if now() falls
+    ///        back to CLOCK_MONOTONIC
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto isInvariant() noexcept
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Calibrated frequency of the counter in ticks per second, 0 if
+    ///        it is not used
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto getFrequency() noexcept
+        -> double;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Conversion of the ticks to CLOCK_MONOTONIC nanoseconds, the multiplier
+    // is a 32.32 fixed point amount of nanoseconds per tick
+    ///////////////////////////////////////////////////////////////////////////
+    struct Calibration {
+        bool isInvariant{ false };
+        ::std::uint64_t multiplier{ 0 };
+        ::std::uint64_t baseTicks{ 0 };
+        ::std::int64_t baseNanoseconds{ 0 };
+        double frequency{ 0 };
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Calibration computed the first time it is needed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto getCalibration() noexcept
+        -> const Tsc::Calibration&;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Checks the CPU and measures the frequency of the counter
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto calibrate() noexcept
+        -> Tsc::Calibration;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Current CLOCK_MONOTONIC time in nanoseconds
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto getMonotonicNanoseconds() noexcept
+        -> ::std::int64_t;
+
+};
+
+
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Clock source reading a POSIX clock through clock_gettime()
+/// \ingroup util
+///
+/// \include ClockSource.hpp <xrn/Util/ClockSource.hpp>
+///
+/// Meant as the Source of ::xrn::util::BasicClock through its aliases:
+///  - ::xrn::util::clockSource::MonotonicCoarse is 5 to 10 times cheaper
+///    than CLOCK_MONOTONIC as it only reads the time of the last tick,
+///    getResolution() (usually 1 to 4 ms) tells its precision
+///  - ::xrn::util::clockSource::MonotonicRaw is not slewed by NTP
+///  - ::xrn::util::clockSource::ThreadCpuTime only advances while the
+///    calling thread runs, telling on-CPU time apart from waiting. A clock
+///    using it must be read from the thread that reset it.
+///
+/// \see ::xrn::util::BasicClock
+///
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::clockid_t clockId
+> class Posix {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    using rep = ::std::int64_t;
+    using period = ::std::nano;
+    using duration = ::std::chrono::nanoseconds;
+    using time_point = ::std::chrono::time_point<Posix>;
+    static constexpr bool is_steady{
+        clockId != CLOCK_THREAD_CPUTIME_ID && clockId != CLOCK_PROCESS_CPUTIME_ID
+    };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Current time of the clock
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static auto now() noexcept
+        -> Posix::time_point;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Precision of the clock as reported by clock_getres()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static auto getResolution() noexcept
+        -> Posix::duration;
+
+};
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief CLOCK_MONOTONIC_COARSE, see ::xrn::util::clockSource::Posix
+///
+///////////////////////////////////////////////////////////////////////////
+using MonotonicCoarse = ::xrn::util::clockSource::Posix<CLOCK_MONOTONIC_COARSE>;
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief CLOCK_MONOTONIC_RAW, see ::xrn::util::clockSource::Posix
+///
+///////////////////////////////////////////////////////////////////////////
+using MonotonicRaw = ::xrn::util::clockSource::Posix<CLOCK_MONOTONIC_RAW>;
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief CLOCK_THREAD_CPUTIME_ID, see ::xrn::util::clockSource::Posix
+///
+///////////////////////////////////////////////////////////////////////////
+using ThreadCpuTime = ::xrn::util::clockSource::Posix<CLOCK_THREAD_CPUTIME_ID>;
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief ::std::chrono::steady_clock, the portable choice
+///
+///////////////////////////////////////////////////////////////////////////
+using Steady = ::std::chrono::steady_clock;
+
+
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Clock source only advanced manually, for tests
+/// \ingroup util
+///
+/// \include ClockSource.hpp <xrn/Util/ClockSource.hpp>
+///
+/// The time is shared by every user of the same Tag, giving each test its
+/// own Tag keeps them independent. It starts at the epoch.
+///
+/// Usage example:
+/// \code
+/// struct Tag;
+/// using TestClock = ::xrn::util::clockSource::Manual<Tag>;
+/// ::xrn::util::BasicClock<::xrn::Time, TestClock> clock;
+/// TestClock::advance(::std::chrono::milliseconds{ 250 });
+/// ::xrn::Time time{ clock.getElapsed() }; // 250ms
+/// \endcode
+///
+/// \see ::xrn::util::BasicClock
+///
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename Tag = void
+> class Manual {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    using rep = ::std::int64_t;
+    using period = ::std::nano;
+    using duration = ::std::chrono::nanoseconds;
+    using time_point = ::std::chrono::time_point<Manual>;
+    static constexpr bool is_steady{ false };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Current time of the clock
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static auto now() noexcept
+        -> Manual::time_point;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Moves the time forward (or backward if amount is negative)
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void advance(
+        ::std::chrono::nanoseconds amount
+    ) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Puts the time back to the epoch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void reset() noexcept;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of nanoseconds since the epoch, shared by the Tag
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static auto getTime() noexcept
+        -> ::std::atomic<Manual::rep>&;
+
+};
+
+} // namespace xrn::util::clockSource
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/ClockSource.impl.hpp>
@@ -0,0 +1,201 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Tsc
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::clockSource::Tsc::now() noexcept
+    -> Tsc::time_point
+{
+    const auto& calibration{ Tsc::getCalibration() };
+    if (!calibration.isInvariant) {
+        return Tsc::time_point{ Tsc::duration{ Tsc::getMonotonicNanoseconds() } };
+    }
+    // split so the product fits in 64 bits for centuries of uptime
+    const auto ticks{ Tsc::readTicks() - calibration.baseTicks };
+    const auto nanoseconds{
+        (ticks >> 32) * calibration.multiplier +
+        (((ticks & 0xFFFF'FFFF) * calibration.multiplier) >> 32)
+    };
+    return Tsc::time_point{ Tsc::duration{
+        calibration.baseNanoseconds + static_cast<::std::int64_t>(nanoseconds)
+    } };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::clockSource::Tsc::readTicks() noexcept
+    -> ::std::uint64_t
+{
+#ifdef XRN_CLOCK_SOURCE_X86
+    unsigned int processor;
+    return ::__rdtscp(&processor);
+#else
+    return 0;
+#endif // XRN_CLOCK_SOURCE_X86
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::clockSource::Tsc::isInvariant() noexcept
+    -> bool
+{
+    return Tsc::getCalibration().isInvariant;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::clockSource::Tsc::getFrequency() noexcept
+    -> double
+{
+    return Tsc::getCalibration().frequency;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::clockSource::Tsc::getCalibration() noexcept
+    -> const Tsc::Calibration&
+{
+    static const Tsc::Calibration calibration{ Tsc::calibrate() };
+    return calibration;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::clockSource::Tsc::calibrate() noexcept
+    -> Tsc::Calibration
+{
+    Tsc::Calibration calibration;
+#ifdef XRN_CLOCK_SOURCE_X86
+    // invariant TSC and rdtscp support are reported by the extended leaves
+    unsigned int eax, ebx, ecx, edx;
+    if (!::__get_cpuid(0x8000'0007, &eax, &ebx, &ecx, &edx) || !(edx & (1u << 8))) {
+        return calibration;
+    }
+    if (!::__get_cpuid(0x8000'0001, &eax, &ebx, &ecx, &edx) || !(edx & (1u << 27))) {
+        return calibration;
+    }
+
+    // the sample with the shortest bracket is the closest to the clock read
+    auto sample{ []{
+        ::std::uint64_t ticks{ 0 };
+        ::std::int64_t nanoseconds{ 0 };
+        auto bestWidth{ ::std::numeric_limits<::std::uint64_t>::max() };
+        for (auto i{ 0 }; i < 8; ++i) {
+            const auto before{ Tsc::readTicks() };
+            const auto time{ Tsc::getMonotonicNanoseconds() };
+            const auto after{ Tsc::readTicks() };
+            if (after - before < bestWidth) {
+                bestWidth = after - before;
+                ticks = before + (after - before) / 2;
+                nanoseconds = time;
+            }
+        }
+        return ::std::pair{ ticks, nanoseconds };
+    } };
+    const auto [startTicks, startNanoseconds]{ sample() };
+    ::std::this_thread::sleep_for(Tsc::calibrationTime);
+    const auto [endTicks, endNanoseconds]{ sample() };
+    if (endTicks <= startTicks || endNanoseconds <= startNanoseconds) {
+        return calibration;
+    }
+
+    const auto ticks{ static_cast<double>(endTicks - startTicks) };
+    const auto nanoseconds{ static_cast<double>(endNanoseconds - startNanoseconds) };
+    calibration.isInvariant = true;
+    calibration.multiplier = static_cast<::std::uint64_t>(nanoseconds / ticks * 4'294'967'296.0 + 0.5);
+    calibration.baseTicks = endTicks;
+    calibration.baseNanoseconds = endNanoseconds;
+    calibration.frequency = ticks * 1'000'000'000.0 / nanoseconds;
+#endif // XRN_CLOCK_SOURCE_X86
+    return calibration;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::clockSource::Tsc::getMonotonicNanoseconds() noexcept
+    -> ::std::int64_t
+{
+    ::timespec time;
+    ::clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<::std::int64_t>(time.tv_sec) * 1'000'000'000 + time.tv_nsec;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Posix
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::clockid_t clockId
+> auto ::xrn::util::clockSource::Posix<clockId>::now() noexcept
+    -> Posix::time_point
+{
+    ::timespec time;
+    ::clock_gettime(clockId, &time);
+    return Posix::time_point{ Posix::duration{
+        static_cast<::std::int64_t>(time.tv_sec) * 1'000'000'000 + time.tv_nsec
+    } };
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::clockid_t clockId
+> auto ::xrn::util::clockSource::Posix<clockId>::getResolution() noexcept
+    -> Posix::duration
+{
+    ::timespec resolution;
+    ::clock_getres(clockId, &resolution);
+    return Posix::duration{
+        static_cast<::std::int64_t>(resolution.tv_sec) * 1'000'000'000 + resolution.tv_nsec
+    };
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Manual
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename Tag
+> auto ::xrn::util::clockSource::Manual<Tag>::now() noexcept
+    -> Manual::time_point
+{
+    return Manual::time_point{ Manual::duration{ Manual::getTime().load(::std::memory_order::relaxed) } };
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename Tag
+> void ::xrn::util::clockSource::Manual<Tag>::advance(
+    ::std::chrono::nanoseconds amount
+) noexcept
+{
+    Manual::getTime().fetch_add(amount.count(), ::std::memory_order::relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename Tag
+> void ::xrn::util::clockSource::Manual<Tag>::reset() noexcept
+{
+    Manual::getTime().store(0, ::std::memory_order::relaxed);
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename Tag
+> auto ::xrn::util::clockSource::Manual<Tag>::getTime() noexcept
+    -> ::std::atomic<Manual::rep>&
+{
+    static ::std::atomic<Manual::rep> time{ 0 };
+    return time;
+}
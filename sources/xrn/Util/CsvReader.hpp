@@ -0,0 +1,259 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/MappedFile.hpp>
+#include <xrn/Util/ByteScanner.hpp>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Reads the records of a delimited file (CSV, TSV, ...)
+/// \ingroup util
+///
+/// \include CsvReader.hpp <xrn/Util/CsvReader.hpp>
+///
+/// ::xrn::util::CsvReader maps the file and exposes each record as a span
+/// of fields viewing the mapping: nothing is copied except quoted fields
+/// containing escaped quotes (""), which are unescaped into buffers reused
+/// from one record to the next.
+/// Quoted fields may contain separators and new lines. Records are split
+/// on "\n" or "\r\n", empty lines are skipped. Separators, new lines and
+/// quotes are searched through ::xrn::util::ByteScanner.
+/// Fields are only valid until the next record is read.
+///
+/// Usage example:
+/// \code
+/// for (auto fields : ::xrn::File::csv("filepath")) {
+///     ::std::string_view name{ fields[0] };
+///     ...
+/// }
+/// \endcode
+///
+/// \see ::xrn::util::File
+///
+///////////////////////////////////////////////////////////////////////////
+class CsvReader {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Input iterator over the records
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Iterator {
+
+    public:
+
+        using value_type = ::std::span<const ::std::string_view>;
+        using difference_type = ::std::ptrdiff_t;
+        using iterator_concept = ::std::input_iterator_tag;
+
+        Iterator() noexcept = default;
+
+        explicit inline Iterator(
+            CsvReader& reader
+        ) noexcept;
+
+        [[ nodiscard ]] inline auto operator*() const noexcept
+            -> ::std::span<const ::std::string_view>;
+
+        inline auto operator++()
+            -> Iterator&;
+
+        inline void operator++(
+            int
+        );
+
+        [[ nodiscard ]] inline auto operator==(
+            ::std::default_sentinel_t
+        ) const noexcept
+            -> bool;
+
+    private:
+
+        CsvReader* m_reader{ nullptr };
+
+    };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Maps a file, nothing is parsed until begin() is called
+    ///
+    /// \param filename Path of the file to read
+    /// \param separator Byte separating two fields (',' for CSV, '\t' for
+    ///        TSV)
+    /// \param quote Byte surrounding quoted fields
+    ///
+    /// \throws ::std::system_error if the file cannot be mapped
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline CsvReader(
+        const ::std::string& filename
+        , char separator = ','
+        , char quote = '"'
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads the records of a file already mapped
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline CsvReader(
+        ::xrn::util::MappedFile mapping
+        , char separator = ','
+        , char quote = '"'
+    ) noexcept;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Range
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parses the first record and returns an iterator on it
+    ///
+    /// The range is single pass: calling begin() again continues from the
+    /// current record.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto begin()
+        -> CsvReader::Iterator;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sentinel marking the end of the file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto end() const noexcept
+        -> ::std::default_sentinel_t;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parses the next record
+    ///
+    /// \return False if the end of the file is reached
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto next()
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Fields of the record parsed by the last call to next()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getFields() const noexcept
+        -> ::std::span<const ::std::string_view>;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parses the quoted field starting after the opening quote at
+    ///        m_position
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto parseQuotedField()
+        -> ::std::string_view;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Replaces every pair of quotes by a single one
+    ///
+    /// \return A view of a buffer reused on the next records
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto unescape(
+        ::std::string_view field
+    ) -> ::std::string_view;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Mapped file and its unparsed part
+    ///////////////////////////////////////////////////////////////////////////
+    ::xrn::util::MappedFile m_mapping;
+    const char* m_position;
+    const char* m_last;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Fields of the current record
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::vector<::std::string_view> m_fields;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Buffers of the unescaped fields, m_unescapedCount are used by the
+    // current record. A deque never moves its elements when growing, so
+    // the fields already unescaped keep pointing to valid strings
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::deque<::std::string> m_unescaped;
+    ::std::size_t m_unescapedCount{ 0 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Format
+    ///////////////////////////////////////////////////////////////////////////
+    char m_separator;
+    char m_quote;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // State of the range
+    ///////////////////////////////////////////////////////////////////////////
+    bool m_isStarted{ false };
+    bool m_isDone{ false };
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using CsvReader = ::xrn::util::CsvReader; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/CsvReader.impl.hpp>
@@ -0,0 +1,223 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Iterator
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::CsvReader::Iterator::Iterator(
+    CsvReader& reader
+) noexcept
+    : m_reader{ &reader }
+{}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::CsvReader::Iterator::operator*() const noexcept
+    -> ::std::span<const ::std::string_view>
+{
+    return m_reader->getFields();
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::CsvReader::Iterator::operator++()
+    -> Iterator&
+{
+    m_reader->next();
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::CsvReader::Iterator::operator++(
+    int
+)
+{
+    ++*this;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::CsvReader::Iterator::operator==(
+    ::std::default_sentinel_t
+) const noexcept
+    -> bool
+{
+    return !m_reader || m_reader->m_isDone;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::CsvReader::CsvReader(
+    const ::std::string& filename
+    , char separator
+    , char quote
+)
+    : CsvReader{
+        ::xrn::util::MappedFile{ filename, ::xrn::util::MappedFile::Advice::sequential }
+        , separator
+        , quote
+    }
+{}
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::CsvReader::CsvReader(
+    ::xrn::util::MappedFile mapping
+    , char separator
+    , char quote
+) noexcept
+    : m_mapping{ ::std::move(mapping) }
+    , m_position{ m_mapping.data() }
+    , m_last{ m_mapping.data() + m_mapping.size() }
+    , m_separator{ separator }
+    , m_quote{ quote }
+{}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Range
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::CsvReader::begin()
+    -> CsvReader::Iterator
+{
+    if (!m_isStarted) {
+        m_isStarted = true;
+        this->next();
+    }
+    return CsvReader::Iterator{ *this };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::CsvReader::end() const noexcept
+    -> ::std::default_sentinel_t
+{
+    return ::std::default_sentinel;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::CsvReader::next()
+    -> bool
+{
+    m_isStarted = true;
+    m_fields.clear();
+    m_unescapedCount = 0;
+
+    // empty lines
+    while (m_position != m_last && (*m_position == '\n' || *m_position == '\r')) {
+        if (*m_position == '\r' && (m_position + 1 == m_last || m_position[1] != '\n')) {
+            break;
+        }
+        ++m_position;
+    }
+    if (m_position == m_last) {
+        m_isDone = true;
+        return false;
+    }
+
+    while (true) {
+        if (m_position != m_last && *m_position == m_quote) {
+            m_fields.push_back(this->parseQuotedField());
+            // bytes between the closing quote and the separator are dropped
+            m_position = ::xrn::util::ByteScanner::findAny(m_position, m_last, m_separator, '\n', '\n');
+        } else {
+            const auto* end{ ::xrn::util::ByteScanner::findAny(m_position, m_last, m_separator, '\n', '\n') };
+            ::std::string_view field{ m_position, static_cast<::std::size_t>(end - m_position) };
+            if (end == m_last || *end == '\n') {
+                field = ::xrn::util::ByteScanner::trimCarriageReturn(field);
+            }
+            m_fields.push_back(field);
+            m_position = end;
+        }
+
+        if (m_position == m_last) {
+            break;
+        }
+        if (*m_position++ == '\n') {
+            break;
+        }
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::CsvReader::getFields() const noexcept
+    -> ::std::span<const ::std::string_view>
+{
+    return m_fields;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::CsvReader::parseQuotedField()
+    -> ::std::string_view
+{
+    const char* const first{ ++m_position };
+    bool isEscaped{ false };
+    while (true) {
+        const auto* quote{ ::xrn::util::ByteScanner::find(m_position, m_last, m_quote) };
+        if (quote == m_last) {
+            m_position = m_last; // unterminated, takes everything left
+            break;
+        }
+        m_position = quote + 1;
+        if (m_position != m_last && *m_position == m_quote) {
+            isEscaped = true;
+            ++m_position;
+            continue;
+        }
+        const ::std::string_view field{ first, static_cast<::std::size_t>(quote - first) };
+        return isEscaped ? this->unescape(field) : field;
+    }
+    const ::std::string_view field{ first, static_cast<::std::size_t>(m_last - first) };
+    return isEscaped ? this->unescape(field) : field;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::CsvReader::unescape(
+    ::std::string_view field
+) -> ::std::string_view
+{
+    if (m_unescapedCount == m_unescaped.size()) {
+        m_unescaped.emplace_back();
+    }
+    auto& buffer{ m_unescaped[m_unescapedCount++] };
+    buffer.clear();
+    for (auto i{ 0uz }; i < field.size(); ++i) {
+        buffer.push_back(field[i]);
+        if (field[i] == m_quote && i + 1 < field.size() && field[i + 1] == m_quote) {
+            ++i;
+        }
+    }
+    return buffer;
+}
@@ -0,0 +1,430 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <fcntl.h>
+#include <xrn/Util/FileDescriptor.hpp>
+
+// codecs are enabled when their header is available, their library must be
+// linked (-lz, -lzstd, -llz4)
+#if __has_include(<zlib.h>) && !defined(XRN_NO_ZLIB)
+    #define XRN_DECOMPRESSING_READER_ZLIB
+    #include <zlib.h>
+#endif // zlib
+#if __has_include(<zstd.h>) && !defined(XRN_NO_ZSTD)
+    #define XRN_DECOMPRESSING_READER_ZSTD
+    #include <zstd.h>
+#endif // zstd
+#if __has_include(<lz4frame.h>) && !defined(XRN_NO_LZ4)
+    #define XRN_DECOMPRESSING_READER_LZ4
+    #include <lz4frame.h>
+#endif // lz4
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Reads a compressed file chunk by chunk of decompressed bytes
+/// \ingroup util
+///
+/// \include DecompressingReader.hpp <xrn/Util/DecompressingReader.hpp>
+///
+/// ::xrn::util::DecompressingReader picks the codec from the magic bytes
+/// of the file (gzip, zstd or lz4 frames, concatenated frames included),
+/// files without a known magic are read as is. It works like
+/// ::xrn::util::ChunkReader: two buffers of chunkSize bytes are reused,
+/// while a chunk is processed the next one is read and decompressed by a
+/// single thread kept for the whole file.
+/// Each codec is available if its header is found at compile time, it can
+/// be disabled by defining XRN_NO_ZLIB, XRN_NO_ZSTD or XRN_NO_LZ4.
+/// ::xrn::util::File::decompressedLines() splits the output in lines.
+///
+/// Usage example:
+/// \code
+/// for (::std::string_view chunk : ::xrn::File::decompress("filepath.zst")) {
+///     ...
+/// }
+/// \endcode
+///
+/// \see ::xrn::util::File, ::xrn::util::ChunkReader
+///
+///////////////////////////////////////////////////////////////////////////
+class DecompressingReader {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default size of a decompressed chunk in bytes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ::std::size_t defaultChunkSize{ 1024 * 1024 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Size of the buffer of compressed bytes read from the file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ::std::size_t inputBufferSize{ 256 * 1024 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Compression format of a file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Codec : ::std::uint8_t {
+        none, ///< Not compressed, read as is
+        gzip, ///< Starts with 1f 8b
+        zstd, ///< Starts with 28 b5 2f fd
+        lz4, ///< lz4 frame, starts with 04 22 4d 18
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Input iterator over the chunks
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Iterator {
+
+    public:
+
+        using value_type = ::std::string_view;
+        using difference_type = ::std::ptrdiff_t;
+        using iterator_concept = ::std::input_iterator_tag;
+
+        Iterator() noexcept = default;
+
+        explicit inline Iterator(
+            DecompressingReader& reader
+        ) noexcept;
+
+        [[ nodiscard ]] inline auto operator*() const noexcept
+            -> ::std::string_view;
+
+        inline auto operator++()
+            -> Iterator&;
+
+        inline void operator++(
+            int
+        );
+
+        [[ nodiscard ]] inline auto operator==(
+            ::std::default_sentinel_t
+        ) const noexcept
+            -> bool;
+
+    private:
+
+        DecompressingReader* m_reader{ nullptr };
+
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Codec of a file starting with header
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto detectCodec(
+        ::std::span<const ::std::byte> header
+    ) noexcept
+        -> DecompressingReader::Codec;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether support for codec was compiled
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static constexpr auto isSupported(
+        DecompressingReader::Codec codec
+    ) noexcept
+        -> bool;
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Opens the file and detects its codec, nothing is decompressed
+    ///        until begin() is called
+    ///
+    /// \param filename Path of the file to read
+    /// \param chunkSize Size of a decompressed chunk, two of them are
+    ///        allocated
+    ///
+    /// \throws ::std::system_error if the file cannot be opened or if its
+    ///         codec is not supported (::std::errc::not_supported)
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline DecompressingReader(
+        const ::std::string& filename
+        , ::std::size_t chunkSize = DecompressingReader::defaultChunkSize
+    );
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Rule of 5
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Stops the background thread once its current decompression is over
+    /// and releases the codec.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline ~DecompressingReader();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy constructor deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    DecompressingReader(
+        const DecompressingReader& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        const DecompressingReader& that
+    ) noexcept
+        -> DecompressingReader& = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move constructor deleted, the background decompression refers
+    ///        to the reader
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    DecompressingReader(
+        DecompressingReader&& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        DecompressingReader&& that
+    ) noexcept
+        -> DecompressingReader& = delete;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Range
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decompresses the first chunk and returns an iterator on it
+    ///
+    /// The range is single pass: calling begin() again continues from the
+    /// current chunk.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto begin()
+        -> DecompressingReader::Iterator;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sentinel marking the end of the decompressed content
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto end() const noexcept
+        -> ::std::default_sentinel_t;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Moves to the next chunk and starts decompressing the one after
+    ///        it
+    ///
+    /// The previous chunk is invalidated.
+    ///
+    /// \return False if the end of the content is reached
+    ///
+    /// \throws ::std::system_error if reading fails, or
+    ///         ::std::errc::illegal_byte_sequence if the content is corrupted
+    ///         or truncated, the reader is then at its end
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto next()
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Chunk decompressed by the last call to next()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getChunk() const noexcept
+        -> ::std::string_view;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Codec detected when opening the file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getCodec() const noexcept
+        -> DecompressingReader::Codec;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Starts decompressing the chunk following the current one into
+    ///        the back buffer
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void prefetch();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Waits for the chunk requested by prefetch()
+    ///
+    /// \return Amount of bytes decompressed into the back buffer
+    ///
+    /// \throws The exception thrown by the decompression, if any
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto waitPrefetch()
+        -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Body of the prefetching thread, serves the requests until
+    ///        stopped
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void runPrefetcher(
+        ::std::stop_token stopToken
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Decompresses up to capacity bytes into output
+    ///
+    /// \return Amount of bytes written, less than capacity only at the end
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto decompressInto(
+        char* output
+        , ::std::size_t capacity
+    ) -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Feeds the unconsumed input to the codec once
+    ///
+    /// \return Amount of input bytes consumed and of output bytes written
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto decompressStep(
+        char* output
+        , ::std::size_t capacity
+    ) -> ::std::pair<::std::size_t, ::std::size_t>;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // File read, and its compressed bytes: [m_inputBegin, m_inputEnd) in
+    // m_input are not consumed yet
+    ///////////////////////////////////////////////////////////////////////////
+    ::xrn::util::FileDescriptor m_fd;
+    ::std::unique_ptr<char[]> m_input;
+    ::std::size_t m_inputBegin{ 0 };
+    ::std::size_t m_inputEnd{ 0 };
+    ::std::size_t m_fileOffset{ 0 };
+    bool m_isFileEnded{ false };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Codec and its state, m_isFrameComplete is false while the codec
+    // expects more input to finish the current frame
+    ///////////////////////////////////////////////////////////////////////////
+    DecompressingReader::Codec m_codec;
+    bool m_isFrameComplete{ true };
+#ifdef XRN_DECOMPRESSING_READER_ZLIB
+    ::z_stream m_zlib{};
+#endif // XRN_DECOMPRESSING_READER_ZLIB
+#ifdef XRN_DECOMPRESSING_READER_ZSTD
+    ::ZSTD_DCtx* m_zstd{ nullptr };
+#endif // XRN_DECOMPRESSING_READER_ZSTD
+#ifdef XRN_DECOMPRESSING_READER_LZ4
+    ::LZ4F_dctx* m_lz4{ nullptr };
+#endif // XRN_DECOMPRESSING_READER_LZ4
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Current chunk lives in m_front, the next one is decompressed in m_back
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::size_t m_chunkSize;
+    ::std::unique_ptr<char[]> m_front;
+    ::std::unique_ptr<char[]> m_back;
+    ::std::string_view m_chunk;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // State of the range
+    ///////////////////////////////////////////////////////////////////////////
+    bool m_isStarted{ false };
+    bool m_isDone{ false };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Request to the prefetching thread and its result: m_isRequested is set
+    // by prefetch(), m_isPrefetched once m_prefetched or m_exception is set
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::mutex m_mutex;
+    ::std::condition_variable_any m_condition;
+    bool m_isRequested{ false };
+    bool m_isPrefetched{ false };
+    ::std::size_t m_prefetched{ 0 };
+    ::std::exception_ptr m_exception;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Background decompression into m_back, started with the first prefetch
+    // and kept for the whole file. Declared last to be joined before the
+    // buffers are destroyed
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::jthread m_prefetcher;
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using DecompressingReader = ::xrn::util::DecompressingReader; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/DecompressingReader.impl.hpp>
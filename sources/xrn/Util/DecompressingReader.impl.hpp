@@ -0,0 +1,462 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Iterator
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::DecompressingReader::Iterator::Iterator(
+    DecompressingReader& reader
+) noexcept
+    : m_reader{ &reader }
+{}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DecompressingReader::Iterator::operator*() const noexcept
+    -> ::std::string_view
+{
+    return m_reader->getChunk();
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DecompressingReader::Iterator::operator++()
+    -> Iterator&
+{
+    m_reader->next();
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::DecompressingReader::Iterator::operator++(
+    int
+)
+{
+    ++*this;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DecompressingReader::Iterator::operator==(
+    ::std::default_sentinel_t
+) const noexcept
+    -> bool
+{
+    return !m_reader || m_reader->m_isDone;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// static elements
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DecompressingReader::detectCodec(
+    ::std::span<const ::std::byte> header
+) noexcept
+    -> DecompressingReader::Codec
+{
+    const auto startsWith{ [header](::std::initializer_list<unsigned char> magic){
+        return header.size() >= magic.size() && ::std::ranges::equal(
+            header.first(magic.size())
+            , magic
+            , {}
+            , {}
+            , [](unsigned char byte){ return ::std::byte{ byte }; }
+        );
+    } };
+
+    if (startsWith({ 0x1f, 0x8b })) {
+        return DecompressingReader::Codec::gzip;
+    }
+    if (startsWith({ 0x28, 0xb5, 0x2f, 0xfd })) {
+        return DecompressingReader::Codec::zstd;
+    }
+    if (startsWith({ 0x04, 0x22, 0x4d, 0x18 })) {
+        return DecompressingReader::Codec::lz4;
+    }
+    return DecompressingReader::Codec::none;
+}
+
+///////////////////////////////////////////////////////////////////////////
+constexpr auto ::xrn::util::DecompressingReader::isSupported(
+    DecompressingReader::Codec codec
+) noexcept
+    -> bool
+{
+    switch (codec) {
+    case DecompressingReader::Codec::none: return true;
+#ifdef XRN_DECOMPRESSING_READER_ZLIB
+    case DecompressingReader::Codec::gzip: return true;
+#endif // XRN_DECOMPRESSING_READER_ZLIB
+#ifdef XRN_DECOMPRESSING_READER_ZSTD
+    case DecompressingReader::Codec::zstd: return true;
+#endif // XRN_DECOMPRESSING_READER_ZSTD
+#ifdef XRN_DECOMPRESSING_READER_LZ4
+    case DecompressingReader::Codec::lz4: return true;
+#endif // XRN_DECOMPRESSING_READER_LZ4
+    default: return false;
+    }
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::DecompressingReader::DecompressingReader(
+    const ::std::string& filename
+    , ::std::size_t chunkSize
+)
+    : m_fd{ filename, O_RDONLY }
+    , m_input{ ::std::make_unique_for_overwrite<char[]>(DecompressingReader::inputBufferSize) }
+    , m_chunkSize{ ::std::max(chunkSize, 1uz) }
+    , m_front{ ::std::make_unique_for_overwrite<char[]>(m_chunkSize) }
+    , m_back{ ::std::make_unique_for_overwrite<char[]>(m_chunkSize) }
+{
+    ::std::array<::std::byte, 4> header;
+    const auto amount{ m_fd.readAt(header.data(), header.size(), 0) };
+    m_codec = DecompressingReader::detectCodec(::std::span{ header }.first(amount));
+    if (!DecompressingReader::isSupported(m_codec)) {
+        throw ::std::system_error{ ::std::make_error_code(::std::errc::not_supported), filename };
+    }
+
+    // only a hint, failing is harmless
+    ::posix_fadvise(m_fd.get(), 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    switch (m_codec) {
+#ifdef XRN_DECOMPRESSING_READER_ZLIB
+    case DecompressingReader::Codec::gzip:
+        // 32 enables the detection of the gzip header
+        if (::inflateInit2(&m_zlib, MAX_WBITS + 32) != Z_OK) {
+            throw ::std::system_error{ ::std::make_error_code(::std::errc::not_enough_memory), "inflateInit2" };
+        }
+        break;
+#endif // XRN_DECOMPRESSING_READER_ZLIB
+#ifdef XRN_DECOMPRESSING_READER_ZSTD
+    case DecompressingReader::Codec::zstd:
+        m_zstd = ::ZSTD_createDCtx();
+        if (!m_zstd) {
+            throw ::std::system_error{ ::std::make_error_code(::std::errc::not_enough_memory), "ZSTD_createDCtx" };
+        }
+        break;
+#endif // XRN_DECOMPRESSING_READER_ZSTD
+#ifdef XRN_DECOMPRESSING_READER_LZ4
+    case DecompressingReader::Codec::lz4:
+        if (::LZ4F_isError(::LZ4F_createDecompressionContext(&m_lz4, LZ4F_VERSION))) {
+            throw ::std::system_error{ ::std::make_error_code(::std::errc::not_enough_memory), "LZ4F_createDecompressionContext" };
+        }
+        break;
+#endif // XRN_DECOMPRESSING_READER_LZ4
+    default:
+        break;
+    }
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Rule of 5
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::DecompressingReader::~DecompressingReader()
+{
+    // the codec is released below, the thread may still be using it
+    if (m_prefetcher.joinable()) {
+        m_prefetcher.request_stop();
+        m_prefetcher.join();
+    }
+#ifdef XRN_DECOMPRESSING_READER_ZLIB
+    if (m_codec == DecompressingReader::Codec::gzip) {
+        ::inflateEnd(&m_zlib);
+    }
+#endif // XRN_DECOMPRESSING_READER_ZLIB
+#ifdef XRN_DECOMPRESSING_READER_ZSTD
+    ::ZSTD_freeDCtx(m_zstd);
+#endif // XRN_DECOMPRESSING_READER_ZSTD
+#ifdef XRN_DECOMPRESSING_READER_LZ4
+    if (m_lz4) {
+        ::LZ4F_freeDecompressionContext(m_lz4);
+    }
+#endif // XRN_DECOMPRESSING_READER_LZ4
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Range
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DecompressingReader::begin()
+    -> DecompressingReader::Iterator
+{
+    if (!m_isStarted) {
+        this->next();
+    }
+    return DecompressingReader::Iterator{ *this };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DecompressingReader::end() const noexcept
+    -> ::std::default_sentinel_t
+{
+    return ::std::default_sentinel;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DecompressingReader::next()
+    -> bool
+{
+    if (m_isDone) {
+        return false;
+    }
+
+    ::std::size_t amount;
+    try {
+        if (!m_isStarted) {
+            m_isStarted = true;
+            amount = this->decompressInto(m_back.get(), m_chunkSize);
+        } else {
+            amount = this->waitPrefetch();
+        }
+    } catch (...) {
+        // the codec state is lost, the following calls end the range
+        m_isDone = true;
+        m_chunk = {};
+        throw;
+    }
+
+    ::std::swap(m_front, m_back);
+    m_chunk = { m_front.get(), amount };
+    if (amount == 0) {
+        m_isDone = true;
+        return false;
+    }
+    this->prefetch();
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DecompressingReader::getChunk() const noexcept
+    -> ::std::string_view
+{
+    return m_chunk;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DecompressingReader::getCodec() const noexcept
+    -> DecompressingReader::Codec
+{
+    return m_codec;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::DecompressingReader::prefetch()
+{
+    // a short chunk is the last one
+    if (m_chunk.size() < m_chunkSize) {
+        m_prefetched = 0;
+        m_isPrefetched = true;
+        return;
+    }
+    if (!m_prefetcher.joinable()) {
+        m_prefetcher = ::std::jthread{ [this](::std::stop_token stopToken){
+            this->runPrefetcher(stopToken);
+        } };
+    }
+    {
+        ::std::scoped_lock lock{ m_mutex };
+        m_isRequested = true;
+    }
+    m_condition.notify_one();
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DecompressingReader::waitPrefetch()
+    -> ::std::size_t
+{
+    ::std::unique_lock lock{ m_mutex };
+    m_condition.wait(lock, [this]{ return m_isPrefetched; });
+    m_isPrefetched = false;
+    if (m_exception) {
+        ::std::rethrow_exception(::std::exchange(m_exception, nullptr));
+    }
+    return m_prefetched;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::DecompressingReader::runPrefetcher(
+    ::std::stop_token stopToken
+)
+{
+    while (true) {
+        ::std::unique_lock lock{ m_mutex };
+        if (!m_condition.wait(lock, stopToken, [this]{ return m_isRequested; })) {
+            return;
+        }
+        m_isRequested = false;
+        // the buffers only change once the result is taken
+        auto* buffer{ m_back.get() };
+        lock.unlock();
+
+        ::std::size_t amount{ 0 };
+        ::std::exception_ptr exception;
+        try {
+            amount = this->decompressInto(buffer, m_chunkSize);
+        } catch (...) {
+            exception = ::std::current_exception();
+        }
+
+        lock.lock();
+        m_prefetched = amount;
+        m_exception = ::std::move(exception);
+        m_isPrefetched = true;
+        lock.unlock();
+        m_condition.notify_one();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DecompressingReader::decompressInto(
+    char* output
+    , ::std::size_t capacity
+) -> ::std::size_t
+{
+    ::std::size_t produced{ 0 };
+    while (produced < capacity) {
+        if (m_inputBegin == m_inputEnd && !m_isFileEnded) {
+            m_inputEnd = m_fd.readAt(m_input.get(), DecompressingReader::inputBufferSize, m_fileOffset);
+            m_inputBegin = 0;
+            m_fileOffset += m_inputEnd;
+            m_isFileEnded = (m_inputEnd < DecompressingReader::inputBufferSize);
+        }
+
+        // codecs may still flush buffered output without any input
+        const auto isFrameComplete{ m_isFrameComplete };
+        const auto [consumed, amount]{ this->decompressStep(output + produced, capacity - produced) };
+        m_inputBegin += consumed;
+        produced += amount;
+        if (consumed || amount) {
+            continue;
+        }
+        // a call without progress after a frame expects the next one
+        m_isFrameComplete = isFrameComplete;
+        if (m_inputBegin != m_inputEnd) {
+            throw ::std::system_error{ ::std::make_error_code(::std::errc::illegal_byte_sequence), "decompress" };
+        }
+        if (m_isFileEnded) {
+            if (!m_isFrameComplete) {
+                throw ::std::system_error{ ::std::make_error_code(::std::errc::illegal_byte_sequence), "truncated" };
+            }
+            break;
+        }
+    }
+    return produced;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DecompressingReader::decompressStep(
+    char* output
+    , ::std::size_t capacity
+) -> ::std::pair<::std::size_t, ::std::size_t>
+{
+    auto* const input{ m_input.get() + m_inputBegin };
+    const auto available{ m_inputEnd - m_inputBegin };
+
+    switch (m_codec) {
+#ifdef XRN_DECOMPRESSING_READER_ZLIB
+    case DecompressingReader::Codec::gzip: {
+        m_zlib.next_in = reinterpret_cast<::Bytef*>(input);
+        m_zlib.avail_in = static_cast<::uInt>(available);
+        m_zlib.next_out = reinterpret_cast<::Bytef*>(output);
+        m_zlib.avail_out = static_cast<::uInt>(::std::min(capacity, ::std::size_t{ UINT_MAX }));
+        const auto result{ ::inflate(&m_zlib, Z_NO_FLUSH) };
+        const ::std::pair<::std::size_t, ::std::size_t> progress{
+            available - m_zlib.avail_in
+            , static_cast<::std::size_t>(reinterpret_cast<char*>(m_zlib.next_out) - output)
+        };
+        if (result == Z_STREAM_END) {
+            // concatenated members are decompressed one after the other
+            m_isFrameComplete = true;
+            ::inflateReset(&m_zlib);
+        } else if (result == Z_OK) {
+            m_isFrameComplete = false;
+        } else if (result != Z_BUF_ERROR) {
+            throw ::std::system_error{ ::std::make_error_code(::std::errc::illegal_byte_sequence), "inflate" };
+        }
+        return progress;
+    }
+#endif // XRN_DECOMPRESSING_READER_ZLIB
+#ifdef XRN_DECOMPRESSING_READER_ZSTD
+    case DecompressingReader::Codec::zstd: {
+        ::ZSTD_inBuffer in{ input, available, 0 };
+        ::ZSTD_outBuffer out{ output, capacity, 0 };
+        const auto result{ ::ZSTD_decompressStream(m_zstd, &out, &in) };
+        if (::ZSTD_isError(result)) {
+            throw ::std::system_error{
+                ::std::make_error_code(::std::errc::illegal_byte_sequence)
+                , ::ZSTD_getErrorName(result)
+            };
+        }
+        m_isFrameComplete = (result == 0);
+        return { in.pos, out.pos };
+    }
+#endif // XRN_DECOMPRESSING_READER_ZSTD
+#ifdef XRN_DECOMPRESSING_READER_LZ4
+    case DecompressingReader::Codec::lz4: {
+        auto consumed{ available };
+        auto amount{ capacity };
+        const auto result{ ::LZ4F_decompress(m_lz4, output, &amount, input, &consumed, nullptr) };
+        if (::LZ4F_isError(result)) {
+            throw ::std::system_error{
+                ::std::make_error_code(::std::errc::illegal_byte_sequence)
+                , ::LZ4F_getErrorName(result)
+            };
+        }
+        m_isFrameComplete = (result == 0);
+        return { consumed, amount };
+    }
+#endif // XRN_DECOMPRESSING_READER_LZ4
+    default: {
+        const auto amount{ ::std::min(available, capacity) };
+        ::std::memcpy(output, input, amount);
+        return { amount, amount };
+    }
+    }
+}
@@ -0,0 +1,220 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <sys/stat.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <xrn/Util/FileDescriptor.hpp>
+#include <xrn/Util/IoUring.hpp>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Lists the files of a directory tree in parallel
+/// \ingroup util
+///
+/// \include DirectoryScanner.hpp <xrn/Util/DirectoryScanner.hpp>
+///
+/// ::xrn::util::DirectoryScanner walks a directory tree with a pool of
+/// threads sharing a queue of directories. Each directory is opened once
+/// and read by large getdents64() batches, the type of the entries comes
+/// from the directory itself so only the files accepted by the filter are
+/// stat'ed. The files accepted from one batch are stat'ed together through
+/// an io_uring of the thread, one IORING_OP_STATX request each and a single
+/// system call for all of them. Kernels without IORING_OP_STATX (before
+/// 5.6) get one statx() call per file. Either way the path is relative to
+/// its directory so it is not looked up from the root again. Links and
+/// entries of unknown type are stat'ed on their own before the filter, to
+/// know what they are.
+/// Symbolic links to files are listed, symbolic links to directories are
+/// not followed. Directories that cannot be opened are skipped.
+/// It is usually used through ::xrn::util::File::scanDirectory().
+///
+/// Usage example:
+/// \code
+/// auto entries{ ::xrn::DirectoryScanner{}.scan("assets", [](::std::string_view path){
+///     return path.ends_with(".png");
+/// }) };
+/// \endcode
+///
+/// \see ::xrn::util::File
+///
+///////////////////////////////////////////////////////////////////////////
+class DirectoryScanner {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief File found by scan()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Entry {
+        ::std::string path; ///< Path of the file, starting with the root
+        ::std::size_t size; ///< Size of the file in bytes
+    };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// \param threadCount Amount of threads walking the tree, 0 uses one
+    ///        thread per hardware thread
+    /// \param isIoUringAllowed False forces one statx() call per file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline DirectoryScanner(
+        ::std::size_t threadCount = 0
+        , bool isIoUringAllowed = true
+    );
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Lists every file under root accepted by filter
+    ///
+    /// filter is called with the path of each file and returns whether it is
+    /// kept. It is called concurrently from several threads. If it throws,
+    /// the scan stops and the exception is rethrown.
+    ///
+    /// \return Entries sorted by path
+    ///
+    /// \throws ::std::system_error if root cannot be opened
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] auto scan(
+        const ::std::string& root
+        , auto&& filter
+    ) -> ::std::vector<DirectoryScanner::Entry>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the files are stat'ed in batches through io_uring
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto isUsingIoUring() const noexcept
+        -> bool;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accepted file waiting for its statx(), name points in the getdents64()
+    // buffer and result is 0 or -errno
+    ///////////////////////////////////////////////////////////////////////////
+    struct Pending {
+        ::std::string path;
+        const char* name;
+        struct ::statx status;
+        int result;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Requests in flight in the io_uring of a thread
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr unsigned queueDepth{ 64 };
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Lists one directory, appending its accepted files to entries
+    ///        and its sub directories to directories
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void scanOne(
+        const ::std::string& directory
+        , auto& filter
+        , ::std::unique_ptr<::xrn::util::IoUring>& ring
+        , ::std::vector<char>& buffer
+        , ::std::vector<DirectoryScanner::Pending>& pending
+        , ::std::vector<DirectoryScanner::Entry>& entries
+        , ::std::vector<::std::string>& directories
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Fills the status and result of every pending file
+    ///
+    /// The ring is dropped if it fails, the files are then stat'ed one by
+    /// one.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static inline void statAll(
+        int directoryFd
+        , ::std::unique_ptr<::xrn::util::IoUring>& ring
+        , ::std::vector<DirectoryScanner::Pending>& pending
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief io_uring supporting IORING_OP_STATX, nullptr if unavailable
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto createRing()
+        -> ::std::unique_ptr<::xrn::util::IoUring>;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Amount of threads walking the tree
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::size_t m_threadCount;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Whether the threads stat the files through their own io_uring
+    ///////////////////////////////////////////////////////////////////////////
+    bool m_isUsingIoUring{ false };
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using DirectoryScanner = ::xrn::util::DirectoryScanner; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/DirectoryScanner.impl.hpp>
@@ -0,0 +1,255 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::DirectoryScanner::DirectoryScanner(
+    ::std::size_t threadCount
+    , bool isIoUringAllowed
+)
+    : m_threadCount{ threadCount ? threadCount : ::std::max(::std::thread::hardware_concurrency(), 1u) }
+    , m_isUsingIoUring{ isIoUringAllowed && DirectoryScanner::createRing() }
+{}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DirectoryScanner::scan(
+    const ::std::string& root
+    , auto&& filter
+) -> ::std::vector<DirectoryScanner::Entry>
+{
+    // fails early on a bad root, the workers skip unreadable directories
+    if (const auto fd{ ::xrn::util::FileDescriptor::open(root, O_RDONLY | O_DIRECTORY) }; !fd) {
+        throw ::std::system_error{ fd.error(), root };
+    }
+
+    ::std::mutex mutex;
+    ::std::condition_variable condition;
+    ::std::vector<::std::string> queue{ root };
+    ::std::size_t pendingCount{ 1 }; // directories queued or being scanned
+    ::std::exception_ptr exception;
+    ::std::vector<DirectoryScanner::Entry> entries;
+
+    {
+        ::std::vector<::std::jthread> workers;
+        workers.reserve(m_threadCount);
+        for (auto i{ 0uz }; i < m_threadCount; ++i) {
+            workers.emplace_back([&]{
+                auto ring{ m_isUsingIoUring ? DirectoryScanner::createRing() : nullptr };
+                ::std::vector<char> buffer(64 * 1024);
+                ::std::vector<DirectoryScanner::Pending> pending;
+                ::std::vector<DirectoryScanner::Entry> found;
+                ::std::vector<::std::string> directories;
+
+                ::std::unique_lock lock{ mutex };
+                while (true) {
+                    condition.wait(lock, [&]{ return !queue.empty() || !pendingCount || exception; });
+                    if (queue.empty() || exception) {
+                        break;
+                    }
+                    // depth first keeps the queue short
+                    auto directory{ ::std::move(queue.back()) };
+                    queue.pop_back();
+                    lock.unlock();
+
+                    try {
+                        DirectoryScanner::scanOne(directory, filter, ring, buffer, pending, found, directories);
+                    } catch (...) {
+                        lock.lock();
+                        if (!exception) {
+                            exception = ::std::current_exception();
+                        }
+                        condition.notify_all();
+                        break;
+                    }
+
+                    lock.lock();
+                    pendingCount += directories.size();
+                    --pendingCount;
+                    for (auto& subdirectory : directories) {
+                        queue.push_back(::std::move(subdirectory));
+                    }
+                    if (!directories.empty() || !pendingCount) {
+                        condition.notify_all();
+                    }
+                    directories.clear();
+                }
+                entries.insert(
+                    entries.end()
+                    , ::std::make_move_iterator(found.begin())
+                    , ::std::make_move_iterator(found.end())
+                );
+            });
+        }
+    }
+
+    if (exception) {
+        ::std::rethrow_exception(exception);
+    }
+    ::std::ranges::sort(entries, {}, &DirectoryScanner::Entry::path);
+    return entries;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DirectoryScanner::isUsingIoUring() const noexcept
+    -> bool
+{
+    return m_isUsingIoUring;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::DirectoryScanner::scanOne(
+    const ::std::string& directory
+    , auto& filter
+    , ::std::unique_ptr<::xrn::util::IoUring>& ring
+    , ::std::vector<char>& buffer
+    , ::std::vector<DirectoryScanner::Pending>& pending
+    , ::std::vector<DirectoryScanner::Entry>& entries
+    , ::std::vector<::std::string>& directories
+)
+{
+    const ::xrn::util::FileDescriptor fd{ ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC) };
+    if (!fd.isValid()) {
+        return; // no permission, removed while scanning, ...
+    }
+    const auto prefix{ directory.ends_with('/') ? directory : directory + '/' };
+
+    while (true) {
+        const auto amount{ ::getdents64(fd.get(), buffer.data(), buffer.size()) };
+        if (amount <= 0) {
+            break;
+        }
+        for (::ssize_t offset{ 0 }; offset < amount;) {
+            const auto* entry{ reinterpret_cast<const ::dirent64*>(buffer.data() + offset) };
+            offset += entry->d_reclen;
+            const ::std::string_view name{ entry->d_name };
+            if (name == "." || name == "..") {
+                continue;
+            }
+
+            const auto type{ entry->d_type };
+            if (type == DT_DIR) {
+                directories.push_back(prefix + entry->d_name);
+                continue;
+            }
+            if (type != DT_REG && type != DT_LNK && type != DT_UNKNOWN) {
+                continue; // fifos, sockets and devices
+            }
+
+            auto path{ prefix + entry->d_name };
+            struct ::statx status;
+            const auto mask{ STATX_TYPE | STATX_SIZE };
+            bool isStated{ false };
+            if (type != DT_REG) {
+                // links are followed to know what they point to, unknown
+                // types come from file systems not filling d_type
+                const auto flags{ (type == DT_LNK) ? 0 : AT_SYMLINK_NOFOLLOW };
+                if (::statx(fd.get(), entry->d_name, flags, mask, &status) == -1) {
+                    continue;
+                }
+                if (S_ISDIR(status.stx_mode) && type == DT_UNKNOWN) {
+                    directories.push_back(::std::move(path));
+                    continue;
+                }
+                if (!S_ISREG(status.stx_mode)) {
+                    continue;
+                }
+                isStated = true;
+            }
+
+            if (!filter(::std::string_view{ path })) {
+                continue;
+            }
+            if (isStated) {
+                entries.push_back({ ::std::move(path), static_cast<::std::size_t>(status.stx_size) });
+            } else {
+                pending.push_back({ ::std::move(path), entry->d_name, {}, 0 });
+            }
+        }
+
+        // the names point in the buffer, stat'ed before the next batch
+        DirectoryScanner::statAll(fd.get(), ring, pending);
+        for (auto& file : pending) {
+            if (file.result == 0) {
+                entries.push_back({ ::std::move(file.path), static_cast<::std::size_t>(file.status.stx_size) });
+            }
+        }
+        pending.clear();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::DirectoryScanner::statAll(
+    int directoryFd
+    , ::std::unique_ptr<::xrn::util::IoUring>& ring
+    , ::std::vector<DirectoryScanner::Pending>& pending
+)
+{
+    constexpr auto mask{ STATX_TYPE | STATX_SIZE };
+    if (ring) {
+        try {
+            for (auto begin{ 0uz }; begin < pending.size();) {
+                auto end{ begin };
+                while (end < pending.size() && ring->prepareStatx(
+                    directoryFd, pending[end].name, AT_SYMLINK_NOFOLLOW, mask, &pending[end].status, end
+                )) {
+                    ++end;
+                }
+                for (auto remaining{ end - begin }; remaining;) {
+                    ring->submit(static_cast<unsigned>(remaining));
+                    remaining -= ring->forEachCompletion([&](::std::uint64_t index, int result){
+                        pending[index].result = result;
+                    });
+                }
+                begin = end;
+            }
+            return;
+        } catch (const ::std::system_error&) {
+            // the kernel may still write into the requests in flight, they
+            // are leaked and the files are stat'ed again without the ring
+            auto* inFlight{ new ::std::vector<DirectoryScanner::Pending>{ ::std::move(pending) } };
+            pending = *inFlight;
+            ring.reset();
+        }
+    }
+    for (auto& file : pending) {
+        file.result = (::statx(directoryFd, file.name, AT_SYMLINK_NOFOLLOW, mask, &file.status) == -1) ? -errno : 0;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::DirectoryScanner::createRing()
+    -> ::std::unique_ptr<::xrn::util::IoUring>
+{
+    try {
+        auto ring{ ::std::make_unique<::xrn::util::IoUring>(DirectoryScanner::queueDepth) };
+        if (ring->isSupported(IORING_OP_STATX)) {
+            return ring;
+        }
+    } catch (const ::std::system_error&) {
+        // io_uring unavailable, statx() is called directly
+    }
+    return nullptr;
+}
@@ -3,7 +3,24 @@
 ///////////////////////////////////////////////////////////////////////////
 // Headers
 ///////////////////////////////////////////////////////////////////////////
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <fcntl.h>
 #include <xrn/Util/Time.hpp>
+#include <xrn/Util/FileDescriptor.hpp>
+#include <xrn/Util/ByteScanner.hpp>
+#include <xrn/Util/MappedFile.hpp>
+#include <xrn/Util/AlignedBuffer.hpp>
+#include <xrn/Util/LineReader.hpp>
+#include <xrn/Util/LineTable.hpp>
+#include <xrn/Util/LineIndex.hpp>
+#include <xrn/Util/CsvReader.hpp>
+#include <xrn/Util/ChunkReader.hpp>
+#include <xrn/Util/DecompressingReader.hpp>
+#include <xrn/Util/FileFollower.hpp>
+#include <xrn/Util/FileWriter.hpp>
+#include <xrn/Util/BatchReader.hpp>
+#include <xrn/Util/DirectoryScanner.hpp>
 
 
 
@@ -25,6 +42,67 @@ namespace xrn::util {
 ///////////////////////////////////////////////////////////////////////////
 class File {
 
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads a file chunk by chunk, see ::xrn::util::ChunkReader
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using ChunkReader = ::xrn::util::ChunkReader;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Writes a file through a large buffer, see
+    ///        ::xrn::util::FileWriter
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Writer = ::xrn::util::FileWriter;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief File found by scanDirectory(), see
+    ///        ::xrn::util::DirectoryScanner
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using DirectoryEntry = ::xrn::util::DirectoryScanner::Entry;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Files being loaded by loadMany()
+    ///
+    /// Holds one future per file, in the order of the filenames. Destroying
+    /// it waits for the remaining reads, the loading thread never outlives
+    /// it.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Batch {
+
+        [[ nodiscard ]] inline auto operator[](
+            ::std::size_t index
+        ) -> ::std::future<::std::string>&;
+
+        [[ nodiscard ]] inline auto size() const noexcept
+            -> ::std::size_t;
+
+        [[ nodiscard ]] inline auto begin() noexcept
+            -> ::std::vector<::std::future<::std::string>>::iterator;
+
+        [[ nodiscard ]] inline auto end() noexcept
+            -> ::std::vector<::std::future<::std::string>>::iterator;
+
+        ::std::vector<::std::future<::std::string>> futures;
+
+        // declared last so it is joined before the futures are destroyed
+        ::std::jthread thread;
+
+    };
+
+
+
 public:
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -52,6 +130,10 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Get the content of a file
     ///
+    /// \throws ::std::system_error if the file cannot be read
+    ///
+    /// \see readInto()
+    ///
     ///////////////////////////////////////////////////////////////////////////
     [[ nodiscard ]] static inline auto getContent(
         const ::std::string& filename
@@ -60,15 +142,570 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Get the content of a file
     ///
+    /// Lines are split on "\n" or "\r\n". An empty vector is returned if the
+    /// file cannot be read.
+    ///
     ///////////////////////////////////////////////////////////////////////////
     [[ nodiscard ]] static inline auto getContentAsVector(
         const ::std::string& filename
     ) -> ::std::vector<::std::string>;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads the content of a file into an existing string
+    ///
+    /// The capacity of out is reused, no allocation happens if it is already
+    /// big enough. Meant for files reloaded in a loop.
+    ///
+    /// \param filename Path of the file to read
+    /// \param out Replaced by the content of the file
+    ///
+    /// \throws ::std::system_error if the file cannot be read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static inline void readInto(
+        const ::std::string& filename
+        , ::std::string& out
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads the content of a file into an existing byte vector
+    ///
+    /// The capacity of out is reused, no allocation happens if it is already
+    /// big enough. Meant for files reloaded in a loop.
+    ///
+    /// \param filename Path of the file to read
+    /// \param out Replaced by the content of the file
+    ///
+    /// \throws ::std::system_error if the file cannot be read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static inline void readInto(
+        const ::std::string& filename
+        , ::std::vector<::std::byte>& out
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the content of a file, allocated from a memory resource
+    ///
+    /// \param filename Path of the file to read
+    /// \param resource Memory resource the string is allocated from, such as
+    ///        a ::std::pmr::monotonic_buffer_resource released once the
+    ///        content is not needed anymore
+    ///
+    /// \throws ::std::system_error if the file cannot be read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto getContent(
+        const ::std::string& filename
+        , ::std::pmr::memory_resource* resource
+    ) -> ::std::pmr::string;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the lines of a file, allocated from a memory resource
+    ///
+    /// The vector and every line are allocated from resource. Lines are
+    /// split on "\n" or "\r\n". An empty vector is returned if the file
+    /// cannot be read.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto getContentAsVector(
+        const ::std::string& filename
+        , ::std::pmr::memory_resource* resource
+    ) -> ::std::pmr::vector<::std::pmr::string>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads the content of a file into an existing string using a
+    ///        memory resource
+    ///
+    /// Same as readInto() with a ::std::string, allocations (if any) go to
+    /// the memory resource of out.
+    ///
+    /// \throws ::std::system_error if the file cannot be read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static inline void readInto(
+        const ::std::string& filename
+        , ::std::pmr::string& out
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the content of a file in an aligned and padded buffer
+    ///
+    /// Meant for SIMD parsers: the content starts on an alignment boundary
+    /// and is followed by at least alignment zeroed bytes, so whole vectors
+    /// can be loaded past its end without copying the tail.
+    ///
+    /// \param filename Path of the file to read
+    /// \param alignment Alignment of the first byte, rounded up to a power
+    ///        of two
+    ///
+    /// \throws ::std::system_error if the file cannot be read
+    ///
+    /// \see ::xrn::util::AlignedBuffer
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto getBinary(
+        const ::std::string& filename
+        , ::std::size_t alignment = ::xrn::util::AlignedBuffer::defaultAlignment
+    ) -> ::xrn::util::AlignedBuffer;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Exception-free
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Same as getContent(), the error is returned instead of thrown
+    ///
+    /// Meant for hot paths (retry loops, probing files that may not exist)
+    /// where failing is expected and unwinding costs too much. The error
+    /// holds the errno of the failing call, or
+    /// ::std::errc::not_enough_memory if an allocation failed.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto tryGetContent(
+        const ::std::string& filename
+    ) noexcept
+        -> ::std::expected<::std::string, ::std::error_code>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Same as getContentAsVector(), failing to read the file is an
+    ///        error instead of an empty vector
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto tryGetContentAsVector(
+        const ::std::string& filename
+    ) noexcept
+        -> ::std::expected<::std::vector<::std::string>, ::std::error_code>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Same as readInto(), the error is returned instead of thrown
+    ///
+    /// The content of out is unspecified on error.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto tryReadInto(
+        const ::std::string& filename
+        , ::std::string& out
+    ) noexcept
+        -> ::std::expected<void, ::std::error_code>;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Zero-copy
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Maps a file in memory without copying its content
+    ///
+    /// \param filename Path of the file to map
+    /// \param advice Access pattern hints given to the kernel
+    ///
+    /// \throws ::std::system_error if the file cannot be opened or mapped
+    ///
+    /// \see ::xrn::util::MappedFile
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto map(
+        const ::std::string& filename
+        , ::xrn::util::MappedFile::Advice advice = ::xrn::util::MappedFile::Advice::normal
+    ) -> ::xrn::util::MappedFile;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Lazily reads the lines of a file
+    ///
+    /// Lines are read on demand through a fixed-size reusable buffer, making
+    /// it suitable for files that do not fit in memory.
+    ///
+    /// \param filename Path of the file to read
+    /// \param bufferSize Initial size of the reusable buffer
+    ///
+    /// \throws ::std::system_error if the file cannot be opened
+    ///
+    /// \see ::xrn::util::LineReader
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto lines(
+        const ::std::string& filename
+        , ::std::size_t bufferSize = ::xrn::util::LineReader::defaultBufferSize
+    ) -> ::xrn::util::LineReader;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Lazily reads the records of a file separated by a delimiter
+    ///
+    /// Same as lines() but records are split on any byte and kept untouched.
+    ///
+    /// \param filename Path of the file to read
+    /// \param delimiter Byte separating two records
+    /// \param bufferSize Initial size of the reusable buffer
+    ///
+    /// \throws ::std::system_error if the file cannot be opened
+    ///
+    /// \see ::xrn::util::LineReader
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto records(
+        const ::std::string& filename
+        , char delimiter
+        , ::std::size_t bufferSize = ::xrn::util::LineReader::defaultBufferSize
+    ) -> ::xrn::util::LineReader;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads a file of any size in fixed-size chunks
+    ///
+    /// The next chunk is read in the background while the current one is
+    /// processed, memory usage is bounded to two chunks.
+    ///
+    /// \param filename Path of the file to read
+    /// \param chunkSize Size of a chunk
+    /// \param isDroppingCache Whether the chunks processed are dropped from
+    ///        the page cache
+    ///
+    /// \throws ::std::system_error if the file cannot be opened
+    ///
+    /// \see ::xrn::util::ChunkReader
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto chunks(
+        const ::std::string& filename
+        , ::std::size_t chunkSize = ::xrn::util::ChunkReader::defaultChunkSize
+        , bool isDroppingCache = true
+    ) -> ::xrn::util::ChunkReader;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Lazily parses the records of a delimited file (CSV, TSV, ...)
+    ///
+    /// Fields are views of the mapped file, only fields containing escaped
+    /// quotes are copied.
+    ///
+    /// \param filename Path of the file to read
+    /// \param separator Byte separating two fields
+    /// \param quote Byte surrounding quoted fields
+    ///
+    /// \throws ::std::system_error if the file cannot be mapped
+    ///
+    /// \see ::xrn::util::CsvReader
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto csv(
+        const ::std::string& filename
+        , char separator = ','
+        , char quote = '"'
+    ) -> ::xrn::util::CsvReader;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Loads a file as a random access table of lines
+    ///
+    /// Prefer it to getContentAsVector() when every line has to be kept, the
+    /// whole content is stored in a single buffer indexed by offsets of the
+    /// type given as template parameter.
+    ///
+    /// \param filename Path of the file to load
+    ///
+    /// \throws ::std::system_error if the file cannot be read
+    ///
+    /// \see ::xrn::util::BasicLineTable
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <
+        ::std::unsigned_integral T = ::std::uint64_t
+    > [[ nodiscard ]] static auto getLineTable(
+        const ::std::string& filename
+    ) -> ::xrn::util::BasicLineTable<T>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Maps a file and indexes its lines on multiple threads
+    ///
+    /// Meant for huge files: the content is not copied and every thread
+    /// indexes its own part of the file.
+    ///
+    /// \param filename Path of the file to index
+    /// \param threadCount Amount of threads used, 0 uses one thread per
+    ///        hardware thread
+    ///
+    /// \throws ::std::system_error if the file cannot be mapped
+    ///
+    /// \see ::xrn::util::BasicLineTable
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <
+        ::std::unsigned_integral T = ::std::uint64_t
+    > [[ nodiscard ]] static auto getLineTable(
+        const ::std::string& filename
+        , ::std::size_t threadCount
+    ) -> ::xrn::util::BasicLineTable<T>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Loads a file as a random access table of records separated by
+    ///        a delimiter
+    ///
+    /// \param filename Path of the file to load
+    /// \param delimiter Byte separating two records
+    ///
+    /// \throws ::std::system_error if the file cannot be read
+    ///
+    /// \see ::xrn::util::BasicLineTable
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <
+        ::std::unsigned_integral T = ::std::uint64_t
+    > [[ nodiscard ]] static auto getRecordTable(
+        const ::std::string& filename
+        , char delimiter
+    ) -> ::xrn::util::BasicLineTable<T>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Loads the persistent line index of a file
+    ///
+    /// The index is stored next to the file and built on the first call or
+    /// when the file changed. Lines are then read one by one from the file.
+    ///
+    /// \param filename Path of the indexed file
+    ///
+    /// \throws ::std::system_error if the file cannot be read or the index
+    ///         cannot be written
+    ///
+    /// \see ::xrn::util::LineIndex
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto getLineIndex(
+        const ::std::string& filename
+    ) -> ::xrn::util::LineIndex;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Compressed
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads a compressed file chunk by chunk of decompressed bytes
+    ///
+    /// The codec (gzip, zstd or lz4) is picked from the magic bytes, other
+    /// files are read as is. The next chunk is decompressed in the
+    /// background while the current one is processed.
+    ///
+    /// \param filename Path of the file to read
+    /// \param chunkSize Size of a decompressed chunk
+    ///
+    /// \throws ::std::system_error if the file cannot be opened or if its
+    ///         codec is not supported
+    ///
+    /// \see ::xrn::util::DecompressingReader
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto decompress(
+        const ::std::string& filename
+        , ::std::size_t chunkSize = ::xrn::util::DecompressingReader::defaultChunkSize
+    ) -> ::xrn::util::DecompressingReader;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Lazily reads the lines of a compressed file
+    ///
+    /// Same as lines() on the output of decompress(), without any temporary
+    /// file.
+    ///
+    /// \throws ::std::system_error if the file cannot be opened or if its
+    ///         codec is not supported
+    ///
+    /// \see ::xrn::util::LineReader
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto decompressedLines(
+        const ::std::string& filename
+        , ::std::size_t bufferSize = ::xrn::util::LineReader::defaultBufferSize
+    ) -> ::xrn::util::LineReader;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Follow
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Yields the lines appended to a file as they arrive, like
+    ///        tail -F
+    ///
+    /// The current content is skipped unless isFromStart, rotations and
+    /// truncations are followed. The range ends once stop() is called.
+    ///
+    /// \param filename Path of the file to follow, it may not exist yet
+    /// \param isFromStart Whether the current content is yielded too
+    ///
+    /// \see ::xrn::util::FileFollower
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto follow(
+        const ::std::string& filename
+        , bool isFromStart = false
+    ) -> ::xrn::util::FileFollower;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Batch
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Loads many files in the background
+    ///
+    /// Reads are batched through io_uring, or a thread pool when io_uring is
+    /// not available. Returns immediately, each future holds the content of
+    /// the file at the same index or the ::std::system_error that occured.
+    ///
+    /// \param filenames Paths of the files to load
+    ///
+    /// \see ::xrn::util::BatchReader, ::xrn::util::File::Batch
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto loadMany(
+        ::std::span<const ::std::string> filenames
+    ) -> File::Batch;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Loads many files and hands each of them to a callback
+    ///
+    /// Blocks until every file is loaded. callback is called, never
+    /// concurrently and in completion order, as
+    /// callback(index, content, errorCode).
+    ///
+    /// \param filenames Paths of the files to load
+    /// \param callback Called once per file
+    ///
+    /// \see ::xrn::util::BatchReader
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void loadMany(
+        ::std::span<const ::std::string> filenames
+        , auto&& callback
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Lists every file of a directory tree accepted by a filter
+    ///
+    /// The tree is walked by one thread per hardware thread.
+    /// filter(path) is called concurrently and returns whether the file is
+    /// kept.
+    ///
+    /// \param root Directory to scan
+    /// \param filter Called once per file
+    ///
+    /// \return Entries sorted by path
+    ///
+    /// \throws ::std::system_error if root cannot be opened
+    ///
+    /// \see ::xrn::util::DirectoryScanner
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static auto scanDirectory(
+        const ::std::string& root
+        , auto&& filter
+    ) -> ::std::vector<File::DirectoryEntry>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Loads every file of a directory tree accepted by a filter
+    ///
+    /// Same as scanDirectory() followed by loadMany(). callback is called,
+    /// never concurrently and in completion order, as
+    /// callback(entry, content, errorCode).
+    ///
+    /// \throws ::std::system_error if root cannot be opened
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void loadDirectory(
+        const ::std::string& root
+        , auto&& filter
+        , auto&& callback
+    );
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Transfer
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copies a file without moving its content through user space
+    ///
+    /// destination is created with the permissions of source, or truncated.
+    ///
+    /// \param source Path of the file to copy
+    /// \param destination Path of the copy
+    ///
+    /// \return Amount of bytes copied
+    ///
+    /// \throws ::std::system_error if a file cannot be opened, if both paths
+    ///         are the same file or if copying fails
+    ///
+    /// \see transfer()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static inline auto copy(
+        const ::std::string& source
+        , const ::std::string& destination
+    ) -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copies everything left to read from input to output
+    ///
+    /// Both file positions are used and advanced. The copy is made by the
+    /// kernel when possible, trying in order copy_file_range() (may share
+    /// the blocks on copy-on-write file systems), sendfile() and splice()
+    /// (when one of the descriptors is a pipe). Read and write through a
+    /// large buffer are used otherwise.
+    ///
+    /// \param input Descriptor read until its end
+    /// \param output Descriptor written
+    ///
+    /// \return Amount of bytes copied
+    ///
+    /// \throws ::std::system_error if copying fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static inline auto transfer(
+        int input
+        , int output
+    ) -> ::std::size_t;
+
 
 
 private:
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Appends every line of reader to lines
+    ///
+    /// Shared by getContentAsVector() and tryGetContentAsVector() so lines
+    /// are always split by ::xrn::util::LineReader, whatever the type of
+    /// the vector.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <
+        typename Lines
+    > [[ nodiscard ]] static auto appendLines(
+        ::xrn::util::LineReader&& reader
+        , Lines lines
+    ) -> Lines;
+
 };
 
 } // namespace xrn::ecs
@@ -13,32 +13,541 @@ auto ::xrn::util::File::getContent(
 )
     -> ::std::string
 {
-    ::std::FILE* f = ::std::fopen(filename.c_str(), "r");
+    ::std::string content;
+    File::readInto(filename, content);
+    return content;
+}
 
-    // Determine file size
-    ::std::fseek(f, 0, SEEK_END);
-    auto size = static_cast<::std::size_t>(::std::ftell(f));
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::getContentAsVector(
+    const ::std::string& filename
+) -> ::std::vector<::std::string>
+{
+    try {
+        return File::appendLines(::xrn::util::LineReader{ filename }, ::std::vector<::std::string>{});
+    } catch (const ::std::system_error&) {
+        return {};
+    }
+}
 
-    char* str = new char[size];
-    ::std::rewind(f);
-    ::std::fread(str, sizeof(char), size, f);
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::File::readInto(
+    const ::std::string& filename
+    , ::std::string& out
+)
+{
+    ::xrn::util::FileDescriptor{ filename, O_RDONLY }.readAll(out);
+}
 
-    return ::std::string{ str, size };
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::File::readInto(
+    const ::std::string& filename
+    , ::std::vector<::std::byte>& out
+)
+{
+    ::xrn::util::FileDescriptor{ filename, O_RDONLY }.readAll(out);
 }
 
 ///////////////////////////////////////////////////////////////////////////
-/// \brief Get the content of a file
-///
+auto ::xrn::util::File::getContent(
+    const ::std::string& filename
+    , ::std::pmr::memory_resource* resource
+) -> ::std::pmr::string
+{
+    ::std::pmr::string content{ resource };
+    File::readInto(filename, content);
+    return content;
+}
+
 ///////////////////////////////////////////////////////////////////////////
 auto ::xrn::util::File::getContentAsVector(
     const ::std::string& filename
-) -> ::std::vector<::std::string>
+    , ::std::pmr::memory_resource* resource
+) -> ::std::pmr::vector<::std::pmr::string>
+{
+    // the strings get the resource of the vector when emplaced
+    try {
+        return File::appendLines(
+            ::xrn::util::LineReader{ filename }
+            , ::std::pmr::vector<::std::pmr::string>{ resource }
+        );
+    } catch (const ::std::system_error&) {
+        return ::std::pmr::vector<::std::pmr::string>{ resource };
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::File::readInto(
+    const ::std::string& filename
+    , ::std::pmr::string& out
+)
+{
+    ::xrn::util::FileDescriptor{ filename, O_RDONLY }.readAll(out);
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::getBinary(
+    const ::std::string& filename
+    , ::std::size_t alignment
+) -> ::xrn::util::AlignedBuffer
+{
+    ::xrn::util::AlignedBuffer buffer{ 0, alignment };
+    ::xrn::util::FileDescriptor{ filename, O_RDONLY }.readAll(buffer);
+    return buffer;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Exception-free
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::tryGetContent(
+    const ::std::string& filename
+) noexcept
+    -> ::std::expected<::std::string, ::std::error_code>
+{
+    ::std::string content;
+    if (const auto result{ File::tryReadInto(filename, content) }; !result) {
+        return ::std::unexpected{ result.error() };
+    }
+    return content;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::tryGetContentAsVector(
+    const ::std::string& filename
+) noexcept
+    -> ::std::expected<::std::vector<::std::string>, ::std::error_code>
+{
+    ::std::string content;
+    if (const auto result{ File::tryReadInto(filename, content) }; !result) {
+        return ::std::unexpected{ result.error() };
+    }
+
+    // the content is split in place, only allocating the lines can fail
+    try {
+        ::std::vector<::std::string> lines;
+        lines.reserve(::xrn::util::ByteScanner::count(content.data(), content.data() + content.size(), '\n') + 1);
+        return File::appendLines(::xrn::util::LineReader::fromContent(::std::move(content)), ::std::move(lines));
+    } catch (const ::std::bad_alloc&) {
+        return ::std::unexpected{ ::std::make_error_code(::std::errc::not_enough_memory) };
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::tryReadInto(
+    const ::std::string& filename
+    , ::std::string& out
+) noexcept
+    -> ::std::expected<void, ::std::error_code>
+{
+    const auto fd{ ::xrn::util::FileDescriptor::open(filename, O_RDONLY) };
+    if (!fd) {
+        return ::std::unexpected{ fd.error() };
+    }
+    return fd->tryReadAll(out);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Zero-copy
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::map(
+    const ::std::string& filename
+    , ::xrn::util::MappedFile::Advice advice
+) -> ::xrn::util::MappedFile
+{
+    return ::xrn::util::MappedFile{ filename, advice };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::lines(
+    const ::std::string& filename
+    , ::std::size_t bufferSize
+) -> ::xrn::util::LineReader
+{
+    return ::xrn::util::LineReader{ filename, bufferSize };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::records(
+    const ::std::string& filename
+    , char delimiter
+    , ::std::size_t bufferSize
+) -> ::xrn::util::LineReader
+{
+    return ::xrn::util::LineReader{ filename, bufferSize, delimiter };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::chunks(
+    const ::std::string& filename
+    , ::std::size_t chunkSize
+    , bool isDroppingCache
+) -> ::xrn::util::ChunkReader
+{
+    return ::xrn::util::ChunkReader{ filename, chunkSize, isDroppingCache };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::csv(
+    const ::std::string& filename
+    , char separator
+    , char quote
+) -> ::xrn::util::CsvReader
+{
+    return ::xrn::util::CsvReader{ filename, separator, quote };
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> auto ::xrn::util::File::getLineTable(
+    const ::std::string& filename
+) -> ::xrn::util::BasicLineTable<T>
+{
+    return ::xrn::util::BasicLineTable<T>{ filename };
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> auto ::xrn::util::File::getLineTable(
+    const ::std::string& filename
+    , ::std::size_t threadCount
+) -> ::xrn::util::BasicLineTable<T>
+{
+    using Advice = ::xrn::util::MappedFile::Advice;
+    return ::xrn::util::BasicLineTable<T>{
+        ::xrn::util::MappedFile{ filename, Advice::sequential | Advice::willNeed }
+        , '\n'
+        , threadCount
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> auto ::xrn::util::File::getRecordTable(
+    const ::std::string& filename
+    , char delimiter
+) -> ::xrn::util::BasicLineTable<T>
+{
+    return ::xrn::util::BasicLineTable<T>{ filename, delimiter };
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::getLineIndex(
+    const ::std::string& filename
+) -> ::xrn::util::LineIndex
+{
+    return ::xrn::util::LineIndex{ filename };
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Compressed
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::decompress(
+    const ::std::string& filename
+    , ::std::size_t chunkSize
+) -> ::xrn::util::DecompressingReader
+{
+    return ::xrn::util::DecompressingReader{ filename, chunkSize };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::decompressedLines(
+    const ::std::string& filename
+    , ::std::size_t bufferSize
+) -> ::xrn::util::LineReader
+{
+    return ::xrn::util::LineReader{ ::std::make_unique<::xrn::util::DecompressingReader>(filename), bufferSize };
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Follow
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::follow(
+    const ::std::string& filename
+    , bool isFromStart
+) -> ::xrn::util::FileFollower
+{
+    return ::xrn::util::FileFollower{ filename, isFromStart };
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Batch
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::Batch::operator[](
+    ::std::size_t index
+) -> ::std::future<::std::string>&
+{
+    return futures[index];
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::Batch::size() const noexcept
+    -> ::std::size_t
+{
+    return futures.size();
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::Batch::begin() noexcept
+    -> ::std::vector<::std::future<::std::string>>::iterator
+{
+    return futures.begin();
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::Batch::end() noexcept
+    -> ::std::vector<::std::future<::std::string>>::iterator
+{
+    return futures.end();
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::loadMany(
+    ::std::span<const ::std::string> filenames
+) -> File::Batch
+{
+    ::std::vector<::std::promise<::std::string>> promises(filenames.size());
+    File::Batch batch;
+    batch.futures.reserve(filenames.size());
+    for (auto& promise : promises) {
+        batch.futures.push_back(promise.get_future());
+    }
+
+    // the thread owns copies, filenames may not outlive the call
+    batch.thread = ::std::jthread{ [
+        filenames = ::std::vector<::std::string>{ filenames.begin(), filenames.end() }
+        , promises = ::std::move(promises)
+    ]() mutable {
+        try {
+            ::xrn::util::BatchReader{}.read(filenames, [&](
+                ::std::size_t index
+                , ::std::string content
+                , ::std::error_code error
+            ){
+                if (error) {
+                    promises[index].set_exception(::std::make_exception_ptr(
+                        ::std::system_error{ error, filenames[index] }
+                    ));
+                } else {
+                    promises[index].set_value(::std::move(content));
+                }
+            });
+        } catch (...) {
+            // unfulfilled promises report the failure, the others are left as is
+            for (auto& promise : promises) {
+                try {
+                    promise.set_exception(::std::current_exception());
+                } catch (const ::std::future_error&) {}
+            }
+        }
+    } };
+
+    return batch;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::File::loadMany(
+    ::std::span<const ::std::string> filenames
+    , auto&& callback
+)
+{
+    ::xrn::util::BatchReader{}.read(filenames, callback);
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::scanDirectory(
+    const ::std::string& root
+    , auto&& filter
+) -> ::std::vector<File::DirectoryEntry>
+{
+    return ::xrn::util::DirectoryScanner{}.scan(root, filter);
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::File::loadDirectory(
+    const ::std::string& root
+    , auto&& filter
+    , auto&& callback
+)
+{
+    const auto entries{ File::scanDirectory(root, filter) };
+    ::std::vector<::std::string> filenames;
+    filenames.reserve(entries.size());
+    for (const auto& entry : entries) {
+        filenames.push_back(entry.path);
+    }
+    ::xrn::util::BatchReader{}.read(filenames, [&](
+        ::std::size_t index
+        , ::std::string content
+        , ::std::error_code error
+    ){
+        callback(entries[index], ::std::move(content), error);
+    });
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Transfer
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::copy(
+    const ::std::string& source
+    , const ::std::string& destination
+) -> ::std::size_t
+{
+    ::xrn::util::FileDescriptor input{ source, O_RDONLY };
+    struct ::stat status;
+    if (::fstat(input.get(), &status) == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), source };
+    }
+
+    // truncating the destination would destroy the source
+    if (struct ::stat destinationStatus; ::stat(destination.c_str(), &destinationStatus) == 0) {
+        if (destinationStatus.st_dev == status.st_dev && destinationStatus.st_ino == status.st_ino) {
+            throw ::std::system_error{ EINVAL, ::std::generic_category(), destination };
+        }
+    }
+
+    ::xrn::util::FileDescriptor output{ destination, O_WRONLY | O_CREAT | O_TRUNC, status.st_mode & 07777 };
+    ::posix_fadvise(input.get(), 0, 0, POSIX_FADV_SEQUENTIAL);
+    return File::transfer(input.get(), output.get());
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::File::transfer(
+    int input
+    , int output
+) -> ::std::size_t
+{
+    constexpr ::std::size_t chunkSize{ 1uz << 30 };
+    ::std::size_t total{ 0 };
+
+    // runs a method until it reports the end of input, some file systems
+    // (procfs, ...) report it early so the next methods are always tried
+    const auto run{ [&](auto&& method){
+        while (true) {
+            const auto amount{ method() };
+            if (amount == -1) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                if (
+                    errno == EXDEV || errno == EINVAL || errno == ENOSYS ||
+                    errno == EOPNOTSUPP || errno == EBADF || errno == ESPIPE
+                ) {
+                    return; // unsupported for these descriptors
+                }
+                throw ::std::system_error{ errno, ::std::generic_category(), "transfer" };
+            }
+            if (amount == 0) {
+                return;
+            }
+            total += static_cast<::std::size_t>(amount);
+        }
+    } };
+
+    run([&]{ return ::copy_file_range(input, nullptr, output, nullptr, chunkSize, 0); });
+    run([&]{ return ::sendfile(output, input, nullptr, chunkSize); });
+
+    struct ::stat inputStatus;
+    struct ::stat outputStatus;
+    if (
+        ::fstat(input, &inputStatus) == 0 && ::fstat(output, &outputStatus) == 0 &&
+        (S_ISFIFO(inputStatus.st_mode) || S_ISFIFO(outputStatus.st_mode))
+    ) {
+        run([&]{ return ::splice(input, nullptr, output, nullptr, chunkSize, SPLICE_F_MOVE); });
+    }
+
+    // user space fallback, also confirms the end of input
+    constexpr ::std::size_t bufferSize{ 1024 * 1024 };
+    const auto buffer{ ::std::make_unique_for_overwrite<char[]>(bufferSize) };
+    while (true) {
+        const auto amount{ ::read(input, buffer.get(), bufferSize) };
+        if (amount == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw ::std::system_error{ errno, ::std::generic_category(), "read" };
+        }
+        if (amount == 0) {
+            return total;
+        }
+        for (::ssize_t written{ 0 }; written < amount;) {
+            const auto result{ ::write(output, buffer.get() + written, static_cast<::std::size_t>(amount - written)) };
+            if (result == -1) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw ::std::system_error{ errno, ::std::generic_category(), "write" };
+            }
+            written += result;
+        }
+        total += static_cast<::std::size_t>(amount);
+    }
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename Lines
+> auto ::xrn::util::File::appendLines(
+    ::xrn::util::LineReader&& reader
+    , Lines lines
+) -> Lines
 {
-    ::std::ifstream file(filename);
-    ::std::vector<::std::string> lines;
-    std::string line;
-    while (std::getline(file, line)) {
-       lines.push_back(line);
+    for (auto line : reader) {
+        lines.emplace_back(line);
     }
     return lines;
 }
@@ -0,0 +1,249 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <sys/stat.h>
+#include <xrn/Util/FileDescriptor.hpp>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Caches the content of files
+/// \ingroup util
+///
+/// \include FileCache.hpp <xrn/Util/FileCache.hpp>
+///
+/// ::xrn::util::FileCache keeps the content of the files it loaded, keyed by
+/// path. Each access costs a single stat(): the cached content is reused as
+/// long as the modification time and the size of the file did not change,
+/// otherwise the file is read again.
+/// The total size of the cached contents is bounded by a byte budget, the
+/// least recently used files are evicted first. Contents are handed out as
+/// shared immutable strings that stay valid after being evicted.
+/// Every function is thread safe.
+///
+/// Usage example:
+/// \code
+/// ::xrn::FileCache cache{ 16 * 1024 * 1024 };
+/// auto content{ cache.get("filepath") }; // ::std::shared_ptr<const ::std::string>
+/// \endcode
+///
+/// \see ::xrn::util::File
+///
+///////////////////////////////////////////////////////////////////////////
+class FileCache {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default maximum amount of bytes cached (64 MiB)
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ::std::size_t defaultBudget{ 64 * 1024 * 1024 };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructs an empty cache
+    ///
+    /// \param budget Maximum amount of bytes cached
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline FileCache(
+        ::std::size_t budget = FileCache::defaultBudget
+    ) noexcept;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gets the content of a file, reading it only if it changed
+    ///
+    /// Files bigger than the budget are read but not cached.
+    ///
+    /// \param filename Path of the file
+    ///
+    /// \throws ::std::system_error if the file cannot be read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto get(
+        const ::std::string& filename
+    ) -> ::std::shared_ptr<const ::std::string>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Removes a file from the cache
+    ///
+    /// Views already handed out stay valid.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void invalidate(
+        const ::std::string& filename
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Removes every file from the cache
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void clear();
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether a file is cached, without checking if it changed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto contains(
+        const ::std::string& filename
+    ) const
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of files cached
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto size() const
+        -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of bytes cached
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getUsedBytes() const
+        -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Maximum amount of bytes cached
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getBudget() const
+        -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Changes the maximum amount of bytes cached, evicting files if
+    ///        needed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void setBudget(
+        ::std::size_t budget
+    );
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Cached file, the key is compared against stat() before reusing it
+    ///////////////////////////////////////////////////////////////////////////
+    struct Entry {
+        ::std::string filename;
+        ::std::shared_ptr<const ::std::string> content;
+        ::timespec modificationTime;
+        ::off_t size;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether an entry still matches the status of its file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto isUpToDate(
+        const Entry& entry
+        , const struct ::stat& status
+    ) noexcept
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Removes an entry, m_mutex must be locked
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void erase(
+        ::std::list<Entry>::iterator it
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Evicts the least recently used entries until the budget is
+    ///        respected, m_mutex must be locked
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void evict();
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Entries, most recently used first
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::list<Entry> m_entries;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Entries by filename
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::unordered_map<::std::string, ::std::list<Entry>::iterator> m_index;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Bytes used and maximum bytes allowed
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::size_t m_usedBytes{ 0 };
+    ::std::size_t m_budget;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Protects every member
+    ///////////////////////////////////////////////////////////////////////////
+    mutable ::std::mutex m_mutex;
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using FileCache = ::xrn::util::FileCache; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/FileCache.impl.hpp>
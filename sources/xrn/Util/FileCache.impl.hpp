@@ -0,0 +1,182 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::FileCache::FileCache(
+    ::std::size_t budget
+) noexcept
+    : m_budget{ budget }
+{}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileCache::get(
+    const ::std::string& filename
+) -> ::std::shared_ptr<const ::std::string>
+{
+    struct ::stat status;
+    if (::stat(filename.c_str(), &status) == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), filename };
+    }
+
+    {
+        ::std::scoped_lock lock{ m_mutex };
+        if (auto it{ m_index.find(filename) }; it != m_index.end()) {
+            if (FileCache::isUpToDate(*it->second, status)) {
+                m_entries.splice(m_entries.begin(), m_entries, it->second);
+                return it->second->content;
+            }
+            this->erase(it->second);
+        }
+    }
+
+    // read outside of the lock, the key comes from the opened file so a
+    // concurrent modification is detected on the next access
+    ::xrn::util::FileDescriptor fd{ filename, O_RDONLY };
+    if (::fstat(fd.get(), &status) == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), filename };
+    }
+    auto content{ ::std::make_shared<::std::string>() };
+    fd.readAll(*content);
+
+    const auto bytes{ content->size() };
+    ::std::scoped_lock lock{ m_mutex };
+    if (bytes > m_budget) {
+        return content;
+    }
+    if (auto it{ m_index.find(filename) }; it != m_index.end()) {
+        this->erase(it->second); // loaded concurrently, keep the newest
+    }
+    m_entries.push_front(Entry{ filename, content, status.st_mtim, status.st_size });
+    m_index.emplace(filename, m_entries.begin());
+    m_usedBytes += bytes;
+    this->evict();
+    return content;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileCache::invalidate(
+    const ::std::string& filename
+)
+{
+    ::std::scoped_lock lock{ m_mutex };
+    if (auto it{ m_index.find(filename) }; it != m_index.end()) {
+        this->erase(it->second);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileCache::clear()
+{
+    ::std::scoped_lock lock{ m_mutex };
+    m_entries.clear();
+    m_index.clear();
+    m_usedBytes = 0;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Getters
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileCache::contains(
+    const ::std::string& filename
+) const
+    -> bool
+{
+    ::std::scoped_lock lock{ m_mutex };
+    return m_index.contains(filename);
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileCache::size() const
+    -> ::std::size_t
+{
+    ::std::scoped_lock lock{ m_mutex };
+    return m_entries.size();
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileCache::getUsedBytes() const
+    -> ::std::size_t
+{
+    ::std::scoped_lock lock{ m_mutex };
+    return m_usedBytes;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileCache::getBudget() const
+    -> ::std::size_t
+{
+    ::std::scoped_lock lock{ m_mutex };
+    return m_budget;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileCache::setBudget(
+    ::std::size_t budget
+)
+{
+    ::std::scoped_lock lock{ m_mutex };
+    m_budget = budget;
+    this->evict();
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileCache::isUpToDate(
+    const Entry& entry
+    , const struct ::stat& status
+) noexcept
+    -> bool
+{
+    return
+        entry.size == status.st_size &&
+        entry.modificationTime.tv_sec == status.st_mtim.tv_sec &&
+        entry.modificationTime.tv_nsec == status.st_mtim.tv_nsec;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileCache::erase(
+    ::std::list<Entry>::iterator it
+)
+{
+    m_usedBytes -= it->content->size();
+    m_index.erase(it->filename);
+    m_entries.erase(it);
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileCache::evict()
+{
+    while (m_usedBytes > m_budget && !m_entries.empty()) {
+        this->erase(::std::prev(m_entries.end()));
+    }
+}
@@ -0,0 +1,302 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Owns a POSIX file descriptor
+/// \ingroup util
+///
+/// \include FileDescriptor.hpp <xrn/Util/FileDescriptor.hpp>
+///
+/// ::xrn::util::FileDescriptor closes its file descriptor when destroyed.
+/// It is the low level building block of the ::xrn::util::File functions
+/// that bypass stdio.
+///
+/// Usage example:
+/// \code
+/// ::xrn::FileDescriptor fd{ "filepath", O_RDONLY };
+/// auto size{ fd.getSize() };
+/// ::pread(fd.get(), buffer, size, 0);
+/// \endcode
+///
+/// \see ::xrn::util::File
+///
+///////////////////////////////////////////////////////////////////////////
+class FileDescriptor {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructs an invalid file descriptor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit FileDescriptor() noexcept = default;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Takes the ownership of a file descriptor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline FileDescriptor(
+        int fd
+    ) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Opens a file
+    ///
+    /// O_CLOEXEC is always added to flags.
+    ///
+    /// \param filename Path of the file to open
+    /// \param flags Flags given to open()
+    /// \param mode Permissions of the file if it is created, the umask
+    ///        applies
+    ///
+    /// \throws ::std::system_error if the file cannot be opened
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline FileDescriptor(
+        const ::std::string& filename
+        , int flags
+        , ::mode_t mode = 0666
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Opens a file without throwing
+    ///
+    /// Same as the constructor, the error is returned instead of thrown.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto open(
+        const ::std::string& filename
+        , int flags
+        , ::mode_t mode = 0666
+    ) noexcept
+        -> ::std::expected<FileDescriptor, ::std::error_code>;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Rule of 5
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Closes the file descriptor.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline ~FileDescriptor();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy constructor deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    FileDescriptor(
+        const FileDescriptor& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        const FileDescriptor& that
+    ) noexcept
+        -> FileDescriptor& = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline FileDescriptor(
+        FileDescriptor&& that
+    ) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move assign operator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto operator=(
+        FileDescriptor&& that
+    ) noexcept
+        -> FileDescriptor&;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Closes the file descriptor if any
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void close() noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gives up the ownership of the file descriptor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto release() noexcept
+        -> int;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads up to size bytes at offset, retrying on EINTR and short
+    ///        reads
+    ///
+    /// \return Amount of bytes read, less than size only at the end of the
+    ///         file
+    ///
+    /// \throws ::std::system_error if reading fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto readAt(
+        void* data
+        , ::std::size_t size
+        , ::std::size_t offset
+    ) const
+        -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Writes size bytes at the current position, retrying on EINTR
+    ///        and short writes
+    ///
+    /// \throws ::std::system_error if writing fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void write(
+        const void* data
+        , ::std::size_t size
+    ) const;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Replaces the content of out by the whole content of the file
+    ///
+    /// out is resized through resize(), its capacity is reused. Files
+    /// reporting a size of 0 (procfs, pipes, ...) are read until the end.
+    ///
+    /// \throws ::std::system_error if reading fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void readAll(
+        auto& out
+    ) const;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Exception-free
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Same as readAt(), the error is returned instead of thrown
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto tryReadAt(
+        void* data
+        , ::std::size_t size
+        , ::std::size_t offset
+    ) const noexcept
+        -> ::std::expected<::std::size_t, ::std::error_code>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Same as readAll(), the error is returned instead of thrown
+    ///
+    /// A failed allocation is reported as ::std::errc::not_enough_memory.
+    /// The content of out is unspecified on error.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] auto tryReadAll(
+        auto& out
+    ) const noexcept
+        -> ::std::expected<void, ::std::error_code>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Same as getSize(), the error is returned instead of thrown
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto tryGetSize() const noexcept
+        -> ::std::expected<::std::size_t, ::std::error_code>;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The file descriptor, -1 if invalid
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto get() const noexcept
+        -> int;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether a file descriptor is owned
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto isValid() const noexcept
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Size of the file as reported by fstat()
+    ///
+    /// \throws ::std::system_error if fstat() fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getSize() const
+        -> ::std::size_t;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // File descriptor, -1 if invalid
+    ///////////////////////////////////////////////////////////////////////////
+    int m_fd{ -1 };
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using FileDescriptor = ::xrn::util::FileDescriptor; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/FileDescriptor.impl.hpp>
@@ -0,0 +1,273 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::FileDescriptor::FileDescriptor(
+    int fd
+) noexcept
+    : m_fd{ fd }
+{}
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::FileDescriptor::FileDescriptor(
+    const ::std::string& filename
+    , int flags
+    , ::mode_t mode
+)
+    : m_fd{ ::open(filename.c_str(), flags | O_CLOEXEC, mode) }
+{
+    if (m_fd == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), filename };
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileDescriptor::open(
+    const ::std::string& filename
+    , int flags
+    , ::mode_t mode
+) noexcept
+    -> ::std::expected<FileDescriptor, ::std::error_code>
+{
+    const auto fd{ ::open(filename.c_str(), flags | O_CLOEXEC, mode) };
+    if (fd == -1) {
+        return ::std::unexpected{ ::std::error_code{ errno, ::std::generic_category() } };
+    }
+    return FileDescriptor{ fd };
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Rule of 5
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::FileDescriptor::~FileDescriptor()
+{
+    this->close();
+}
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::FileDescriptor::FileDescriptor(
+    FileDescriptor&& that
+) noexcept
+    : m_fd{ ::std::exchange(that.m_fd, -1) }
+{}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileDescriptor::operator=(
+    FileDescriptor&& that
+) noexcept
+    -> FileDescriptor&
+{
+    if (this != &that) {
+        this->close();
+        m_fd = ::std::exchange(that.m_fd, -1);
+    }
+    return *this;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileDescriptor::close() noexcept
+{
+    if (m_fd != -1) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileDescriptor::release() noexcept
+    -> int
+{
+    return ::std::exchange(m_fd, -1);
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileDescriptor::readAt(
+    void* data
+    , ::std::size_t size
+    , ::std::size_t offset
+) const
+    -> ::std::size_t
+{
+    const auto amount{ this->tryReadAt(data, size, offset) };
+    if (!amount) {
+        throw ::std::system_error{ amount.error(), "pread" };
+    }
+    return *amount;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileDescriptor::write(
+    const void* data
+    , ::std::size_t size
+) const
+{
+    ::std::size_t total{ 0 };
+    while (total < size) {
+        const auto amount{ ::write(m_fd, static_cast<const char*>(data) + total, size - total) };
+        if (amount == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw ::std::system_error{ errno, ::std::generic_category(), "write" };
+        }
+        total += static_cast<::std::size_t>(amount);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileDescriptor::readAll(
+    auto& out
+) const
+{
+    if (auto result{ this->tryReadAll(out) }; !result) {
+        throw ::std::system_error{ result.error() };
+    }
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Exception-free
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileDescriptor::tryReadAt(
+    void* data
+    , ::std::size_t size
+    , ::std::size_t offset
+) const noexcept
+    -> ::std::expected<::std::size_t, ::std::error_code>
+{
+    ::std::size_t total{ 0 };
+    while (total < size) {
+        const auto amount{ ::pread(
+            m_fd
+            , static_cast<char*>(data) + total
+            , size - total
+            , static_cast<::off_t>(offset + total)
+        ) };
+        if (amount == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return ::std::unexpected{ ::std::error_code{ errno, ::std::generic_category() } };
+        }
+        if (amount == 0) {
+            break;
+        }
+        total += static_cast<::std::size_t>(amount);
+    }
+    return total;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileDescriptor::tryReadAll(
+    auto& out
+) const noexcept
+    -> ::std::expected<void, ::std::error_code>
+{
+    const auto size{ this->tryGetSize() };
+    if (!size) {
+        return ::std::unexpected{ size.error() };
+    }
+
+    try {
+        // resize() only initializes bytes when growing, reloading a file of
+        // the same size costs nothing but the read
+        out.resize(*size);
+        auto total{ this->tryReadAt(out.data(), *size, 0) };
+        if (!total) {
+            return ::std::unexpected{ total.error() };
+        }
+
+        if (*size == 0) {
+            for (auto chunkSize{ 4096uz };; chunkSize *= 2) {
+                out.resize(*total + chunkSize);
+                const auto amount{ this->tryReadAt(out.data() + *total, chunkSize, *total) };
+                if (!amount) {
+                    return ::std::unexpected{ amount.error() };
+                }
+                *total += *amount;
+                if (*amount < chunkSize) {
+                    break;
+                }
+            }
+        }
+        out.resize(*total);
+    } catch (const ::std::bad_alloc&) {
+        return ::std::unexpected{ ::std::make_error_code(::std::errc::not_enough_memory) };
+    } catch (const ::std::length_error&) {
+        return ::std::unexpected{ ::std::make_error_code(::std::errc::not_enough_memory) };
+    }
+    return {};
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileDescriptor::tryGetSize() const noexcept
+    -> ::std::expected<::std::size_t, ::std::error_code>
+{
+    struct ::stat status;
+    if (::fstat(m_fd, &status) == -1) {
+        return ::std::unexpected{ ::std::error_code{ errno, ::std::generic_category() } };
+    }
+    return static_cast<::std::size_t>(status.st_size);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Getters
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileDescriptor::get() const noexcept
+    -> int
+{
+    return m_fd;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileDescriptor::isValid() const noexcept
+    -> bool
+{
+    return m_fd != -1;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileDescriptor::getSize() const
+    -> ::std::size_t
+{
+    const auto size{ this->tryGetSize() };
+    if (!size) {
+        throw ::std::system_error{ size.error(), "fstat" };
+    }
+    return *size;
+}
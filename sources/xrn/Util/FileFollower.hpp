@@ -0,0 +1,385 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <sys/inotify.h>
+#include <sys/eventfd.h>
+#include <sys/stat.h>
+#include <poll.h>
+#include <xrn/Util/FileDescriptor.hpp>
+#include <xrn/Util/ByteScanner.hpp>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Yields the lines appended to a file as they are written
+/// \ingroup util
+///
+/// \include FileFollower.hpp <xrn/Util/FileFollower.hpp>
+///
+/// ::xrn::util::FileFollower behaves like tail -F: it keeps its read
+/// offset and only reads the bytes appended since the last read, whatever
+/// the size of the file. The directory of the file is watched through
+/// inotify, the file is also checked with a timeout growing from
+/// minInterval to maxInterval while nothing happens, which is the only
+/// mechanism when inotify is not available (or not reliable, as on network
+/// file systems).
+/// Rotations are followed: when the path refers to a new file, the rest of
+/// the previous one is read, then the new one is read from its start. A
+/// file truncated in place is read again from its start, the last bytes
+/// read are compared to detect it even if the file grew past the offset
+/// since.
+/// A line is yielded once its "\n" is written, the "\r" of a "\r\n" is
+/// removed. A yielded view is only valid until the next line is requested.
+/// The range only ends when stop() is called, from any thread.
+///
+/// Usage example:
+/// \code
+/// for (::std::string_view line : ::xrn::File::follow("/var/log/app.log")) {
+///     ...
+/// }
+/// \endcode
+///
+/// \see ::xrn::util::File, ::xrn::util::FileWatcher
+///
+///////////////////////////////////////////////////////////////////////////
+class FileFollower {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Milliseconds between two checks right after a change
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr int minInterval{ 10 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Milliseconds between two checks once the file is idle
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr int maxInterval{ 1000 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Maximum amount of bytes read at once, so following a large
+    ///        file from its start does not load it whole
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ::std::size_t readSize{ 64uz * 1024 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of bytes kept from the end of what was read to detect a
+    ///        file truncated then written past the offset again
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ::std::size_t tailSize{ 64 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Input iterator over the lines
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Iterator {
+
+    public:
+
+        using value_type = ::std::string_view;
+        using difference_type = ::std::ptrdiff_t;
+        using iterator_concept = ::std::input_iterator_tag;
+
+        Iterator() noexcept = default;
+
+        explicit inline Iterator(
+            FileFollower& follower
+        ) noexcept;
+
+        [[ nodiscard ]] inline auto operator*() const noexcept
+            -> ::std::string_view;
+
+        inline auto operator++()
+            -> Iterator&;
+
+        inline void operator++(
+            int
+        );
+
+        [[ nodiscard ]] inline auto operator==(
+            ::std::default_sentinel_t
+        ) const noexcept
+            -> bool;
+
+    private:
+
+        FileFollower* m_follower{ nullptr };
+
+    };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Starts following a file
+    ///
+    /// The file may not exist yet, it is then read from its start once
+    /// created.
+    ///
+    /// \param filename Path of the file to follow
+    /// \param isFromStart Whether the current content is yielded too,
+    ///        otherwise only the lines appended from now on are
+    ///
+    /// \throws ::std::system_error if the wake up event cannot be created
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline FileFollower(
+        const ::std::string& filename
+        , bool isFromStart = false
+    );
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Rule of 5
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~FileFollower() = default;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy constructor deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    FileFollower(
+        const FileFollower& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        const FileFollower& that
+    ) noexcept
+        -> FileFollower& = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move constructor deleted, stop() may be called from another
+    ///        thread
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    FileFollower(
+        FileFollower&& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        FileFollower&& that
+    ) noexcept
+        -> FileFollower& = delete;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Range
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Waits for the first line and returns an iterator on it
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto begin()
+        -> FileFollower::Iterator;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sentinel reached once stopped
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto end() const noexcept
+        -> ::std::default_sentinel_t;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Waits for the next line
+    ///
+    /// The previous line is invalidated.
+    ///
+    /// \param timeout Milliseconds to wait for a line, 0 only checks the
+    ///        file, -1 waits forever
+    ///
+    /// \return False if no line was appended in time or if stopped
+    ///
+    /// \throws ::std::system_error if reading fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto next(
+        int timeout = -1
+    ) -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Line read by the last successful call to next()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getLine() const noexcept
+        -> ::std::string_view;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Wakes up and ends the range, can be called from any thread
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void stop() noexcept;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Position in the followed file of the next byte read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getOffset() const noexcept
+        -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether changes are notified by inotify, otherwise only the
+    ///        periodic checks happen
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto isUsingInotify() const noexcept
+        -> bool;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Follows rotations and truncations, then reads what was
+    ///        appended
+    ///
+    /// \return Whether bytes were read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto update()
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads from the offset to the end of the current file
+    ///
+    /// \return Whether bytes were read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto readAppended()
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Waits for an inotify event, stop() or the timeout
+    ///
+    /// \return Whether an inotify event was received
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto wait(
+        int timeout
+    ) -> bool;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Followed path, and the file it referred to when last opened (invalid
+    // while it does not exist)
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::string m_filename;
+    ::xrn::util::FileDescriptor m_fd;
+    ::dev_t m_device{ 0 };
+    ::ino_t m_inode{ 0 };
+    ::std::size_t m_offset{ 0 };
+    ::std::string m_tail;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // inotify instance watching the directory (invalid if not available),
+    // and the event written by stop()
+    ///////////////////////////////////////////////////////////////////////////
+    ::xrn::util::FileDescriptor m_inotify;
+    ::xrn::util::FileDescriptor m_wakeUp;
+    int m_interval{ FileFollower::minInterval };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Unconsumed bytes are [m_begin, end) in m_buffer, bytes in
+    // [m_begin, m_scanned) are known not to contain '\n'
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::string m_buffer;
+    ::std::size_t m_begin{ 0 };
+    ::std::size_t m_scanned{ 0 };
+    ::std::string_view m_line;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // State of the range
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::atomic<bool> m_isStopped{ false };
+    bool m_isStarted{ false };
+    bool m_isDone{ false };
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using FileFollower = ::xrn::util::FileFollower; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/FileFollower.impl.hpp>
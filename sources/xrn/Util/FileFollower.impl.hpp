@@ -0,0 +1,352 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Iterator
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::FileFollower::Iterator::Iterator(
+    FileFollower& follower
+) noexcept
+    : m_follower{ &follower }
+{}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileFollower::Iterator::operator*() const noexcept
+    -> ::std::string_view
+{
+    return m_follower->getLine();
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileFollower::Iterator::operator++()
+    -> Iterator&
+{
+    m_follower->next();
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileFollower::Iterator::operator++(
+    int
+)
+{
+    ++*this;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileFollower::Iterator::operator==(
+    ::std::default_sentinel_t
+) const noexcept
+    -> bool
+{
+    return !m_follower || m_follower->m_isDone;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::FileFollower::FileFollower(
+    const ::std::string& filename
+    , bool isFromStart
+)
+    : m_filename{ filename }
+    , m_wakeUp{ ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC) }
+{
+    if (!m_wakeUp.isValid()) {
+        throw ::std::system_error{ errno, ::std::generic_category(), "eventfd" };
+    }
+
+    // the directory is watched so the creation of a rotated file is seen,
+    // without inotify (or out of watches) the periodic checks are enough
+    m_inotify = ::xrn::util::FileDescriptor{ ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC) };
+    if (m_inotify.isValid()) {
+        const auto directory{ ::std::filesystem::path{ filename }.parent_path() };
+        if (::inotify_add_watch(
+            m_inotify.get()
+            , directory.empty() ? "." : directory.c_str()
+            , IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO
+        ) == -1) {
+            m_inotify.close();
+        }
+    }
+
+    auto fd{ ::xrn::util::FileDescriptor::open(filename, O_RDONLY) };
+    if (!fd) {
+        return; // read from its start once created
+    }
+    struct ::stat status;
+    if (::fstat(fd->get(), &status) == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), filename };
+    }
+    m_fd = ::std::move(*fd);
+    m_device = status.st_dev;
+    m_inode = status.st_ino;
+    if (!isFromStart) {
+        m_offset = static_cast<::std::size_t>(status.st_size);
+        m_tail.resize(::std::min(m_offset, FileFollower::tailSize));
+        m_tail.resize(m_fd.readAt(m_tail.data(), m_tail.size(), m_offset - m_tail.size()));
+    }
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Range
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileFollower::begin()
+    -> FileFollower::Iterator
+{
+    if (!m_isStarted) {
+        this->next();
+    }
+    return FileFollower::Iterator{ *this };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileFollower::end() const noexcept
+    -> ::std::default_sentinel_t
+{
+    return ::std::default_sentinel;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileFollower::next(
+    int timeout
+) -> bool
+{
+    if (m_isDone) {
+        return false;
+    }
+    m_isStarted = true;
+
+    const auto deadline{ ::std::chrono::steady_clock::now() + ::std::chrono::milliseconds{ timeout } };
+    while (true) {
+        const auto* last{ m_buffer.data() + m_buffer.size() };
+        const auto* newline{ ::xrn::util::ByteScanner::find(m_buffer.data() + m_scanned, last, '\n') };
+        if (newline != last) {
+            m_line = ::xrn::util::ByteScanner::trimCarriageReturn(
+                ::std::string_view{ m_buffer.data() + m_begin, newline }
+            );
+            m_begin = static_cast<::std::size_t>(newline - m_buffer.data()) + 1;
+            m_scanned = m_begin;
+            return true;
+        }
+
+        // only the partial line is kept before reading more
+        m_buffer.erase(0, m_begin);
+        m_scanned = m_buffer.size();
+        m_begin = 0;
+        m_line = {};
+
+        if (m_isStopped.load(::std::memory_order::acquire)) {
+            m_isDone = true;
+            return false;
+        }
+        if (this->update()) {
+            m_interval = FileFollower::minInterval;
+            continue;
+        }
+
+        auto waitTime{ m_interval };
+        if (timeout >= 0) {
+            const auto remaining{ ::std::chrono::duration_cast<::std::chrono::milliseconds>(
+                deadline - ::std::chrono::steady_clock::now()
+            ).count() };
+            if (remaining <= 0) {
+                return false;
+            }
+            waitTime = static_cast<int>(::std::min<::std::int64_t>(waitTime, remaining));
+        }
+        // backs off while nothing happens, an inotify event checks again at once
+        if (this->wait(waitTime)) {
+            m_interval = FileFollower::minInterval;
+        } else {
+            m_interval = ::std::min(m_interval * 2, FileFollower::maxInterval);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileFollower::getLine() const noexcept
+    -> ::std::string_view
+{
+    return m_line;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileFollower::stop() noexcept
+{
+    m_isStopped.store(true, ::std::memory_order::release);
+    ::eventfd_write(m_wakeUp.get(), 1);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Getters
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileFollower::getOffset() const noexcept
+    -> ::std::size_t
+{
+    return m_offset;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileFollower::isUsingInotify() const noexcept
+    -> bool
+{
+    return m_inotify.isValid();
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileFollower::update()
+    -> bool
+{
+    struct ::stat status;
+    if (::stat(m_filename.c_str(), &status) == -1) {
+        // removed and not created again yet, the old file may still grow
+        return m_fd.isValid() && this->readAppended();
+    }
+    if (m_fd.isValid() && status.st_dev == m_device && status.st_ino == m_inode) {
+        return this->readAppended();
+    }
+
+    auto fd{ ::xrn::util::FileDescriptor::open(m_filename, O_RDONLY) };
+    if (!fd || ::fstat(fd->get(), &status) == -1) {
+        return m_fd.isValid() && this->readAppended();
+    }
+
+    // rotated, the end of the previous file is read before switching and its
+    // last line is terminated
+    bool isRead{ false };
+    if (m_fd.isValid()) {
+        while (this->readAppended()) {
+            isRead = true;
+        }
+        if (m_buffer.size() > m_begin) {
+            m_buffer.push_back('\n');
+            isRead = true;
+        }
+    }
+    m_fd = ::std::move(*fd);
+    m_device = status.st_dev;
+    m_inode = status.st_ino;
+    m_offset = 0;
+    m_tail.clear();
+    return this->readAppended() || isRead;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileFollower::readAppended()
+    -> bool
+{
+    const auto size{ m_fd.getSize() };
+    if (size == m_offset) {
+        return false;
+    }
+
+    // truncated in place (and maybe written past the offset since), read
+    // again from the start and terminate the partial line
+    bool isTruncated{ size < m_offset };
+    if (!isTruncated && !m_tail.empty()) {
+        char tail[FileFollower::tailSize];
+        isTruncated =
+            m_fd.readAt(tail, m_tail.size(), m_offset - m_tail.size()) != m_tail.size() ||
+            ::std::string_view{ tail, m_tail.size() } != m_tail;
+    }
+    bool isTerminated{ false };
+    if (isTruncated) {
+        if (m_buffer.size() > m_begin) {
+            m_buffer.push_back('\n');
+            isTerminated = true;
+        }
+        m_offset = 0;
+        m_tail.clear();
+        if (size == 0) {
+            return isTerminated;
+        }
+    }
+
+    const auto previousSize{ m_buffer.size() };
+    const auto amount{ ::std::min(size - m_offset, FileFollower::readSize) };
+    m_buffer.resize(previousSize + amount);
+    const auto read{ m_fd.readAt(m_buffer.data() + previousSize, amount, m_offset) };
+    m_buffer.resize(previousSize + read);
+    m_offset += read;
+    m_tail.append(m_buffer, previousSize);
+    if (m_tail.size() > FileFollower::tailSize) {
+        m_tail.erase(0, m_tail.size() - FileFollower::tailSize);
+    }
+    return read != 0 || isTerminated;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileFollower::wait(
+    int timeout
+) -> bool
+{
+    // poll() ignores the inotify entry if it is invalid
+    ::pollfd pollFds[2]{
+        { m_wakeUp.get(), POLLIN, 0 }
+        , { m_inotify.get(), POLLIN, 0 }
+    };
+    int ready;
+    do {
+        ready = ::poll(pollFds, 2, timeout);
+    } while (ready == -1 && errno == EINTR);
+    if (ready == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), "poll" };
+    }
+    if (!(pollFds[1].revents & POLLIN)) {
+        return false;
+    }
+
+    // the events themselves are not needed, the file is checked anyway
+    alignas(::inotify_event) char buffer[4096];
+    while (true) {
+        const auto amount{ ::read(m_inotify.get(), buffer, sizeof(buffer)) };
+        if (amount > 0 || (amount == -1 && errno == EINTR)) {
+            continue;
+        }
+        return true;
+    }
+}
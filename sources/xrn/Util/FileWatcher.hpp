@@ -0,0 +1,307 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <poll.h>
+#include <xrn/Util/FileDescriptor.hpp>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Notifies subscribers when watched files change
+/// \ingroup util
+///
+/// \include FileWatcher.hpp <xrn/Util/FileWatcher.hpp>
+///
+/// ::xrn::util::FileWatcher relies on inotify instead of polling the files.
+/// Subscribers are only notified when the size or the modification time of
+/// a file actually changed. When the file only grew and its previous end is
+/// untouched (logs, journals, ...), only the appended bytes are read and
+/// handed to the subscribers, otherwise the whole file is read again.
+/// Files replaced through a rename (as most editors do) keep being watched,
+/// as do files moved away or removed then created again (as logrotate
+/// does): the parent directory is watched for the creation of the path.
+/// Notifications are dispatched by poll(), on the calling thread. watch()
+/// and unwatch() must not be called from a callback.
+///
+/// Usage example:
+/// \code
+/// ::xrn::FileWatcher watcher;
+/// watcher.watch("filepath", [](const ::xrn::FileWatcher::Change& change){
+///     if (change.isAppended) { ... } else { ... }
+/// });
+/// while (true) {
+///     watcher.poll(-1);
+/// }
+/// \endcode
+///
+/// \see ::xrn::util::File
+///
+///////////////////////////////////////////////////////////////////////////
+class FileWatcher {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Change handed to the subscribers
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    struct Change {
+        ///////////////////////////////////////////////////////////////////////////
+        /// \brief Path given to watch()
+        ///
+        ///////////////////////////////////////////////////////////////////////////
+        const ::std::string& filename;
+
+        ///////////////////////////////////////////////////////////////////////////
+        /// \brief Bytes read, only valid during the notification
+        ///
+        ///////////////////////////////////////////////////////////////////////////
+        ::std::string_view content;
+
+        ///////////////////////////////////////////////////////////////////////////
+        /// \brief Position of content in the file, 0 if the file was re-read
+        ///
+        ///////////////////////////////////////////////////////////////////////////
+        ::std::size_t offset;
+
+        ///////////////////////////////////////////////////////////////////////////
+        /// \brief Whether content only contains the bytes appended
+        ///
+        ///////////////////////////////////////////////////////////////////////////
+        bool isAppended;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Callback called on each change
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Callback = ::std::function<void(const Change&)>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of bytes kept from the end of a file to detect rewrites
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ::std::size_t tailSize{ 64 };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Creates the inotify instance
+    ///
+    /// \throws ::std::system_error if inotify is not available
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline FileWatcher();
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Subscribes to the changes of a file
+    ///
+    /// The current content is considered known, the first notification
+    /// happens on the next change.
+    ///
+    /// \throws ::std::system_error if the file cannot be watched
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void watch(
+        const ::std::string& filename
+        , Callback callback
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Removes every subscriber of a file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void unwatch(
+        const ::std::string& filename
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Waits for changes and notifies the subscribers
+    ///
+    /// \param timeout Milliseconds to wait for an event, 0 returns
+    ///        immediately, -1 waits forever
+    ///
+    /// \return Amount of changes notified
+    ///
+    /// \throws ::std::system_error if reading the events fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto poll(
+        int timeout = 0
+    ) -> ::std::size_t;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The inotify file descriptor, to be added to an event loop
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getFd() const noexcept
+        -> int;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether a file is watched
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto isWatched(
+        const ::std::string& filename
+    ) const
+        -> bool;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // State of a watched file
+    ///////////////////////////////////////////////////////////////////////////
+    struct Watch {
+        ::std::string filename;
+        ::std::vector<Callback> callbacks;
+        ::std::size_t size{ 0 };
+        ::timespec modificationTime{};
+        ::std::string tail;
+        int directory{ -1 };
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Adds the inotify watch of a file
+    ///
+    /// \return The watch descriptor, -1 on failure
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto addWatch(
+        const ::std::string& filename
+    ) noexcept
+        -> int;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Adds the inotify watch of the parent directory of a file, to
+    ///        be notified when the file is created again
+    ///
+    /// \return The watch descriptor, -1 on failure
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto addDirectoryWatch(
+        const ::std::string& filename
+    ) -> int;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Removes the watches of the directories without watched files
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void removeUnusedDirectoryWatches() noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Stores the size, modification time and tail of a file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static inline void snapshot(
+        Watch& watch
+        , const ::xrn::util::FileDescriptor& fd
+        , const struct ::stat& status
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads what changed and notifies the subscribers
+    ///
+    /// \return Whether the subscribers were notified
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto reload(
+        Watch& watch
+    ) -> bool;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // inotify instance
+    ///////////////////////////////////////////////////////////////////////////
+    ::xrn::util::FileDescriptor m_fd;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Watched files by watch descriptor, and watch descriptors by filename
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::unordered_map<int, Watch> m_watches;
+    ::std::unordered_map<::std::string, int> m_descriptors;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Watched files whose path does not exist anymore, waiting for it to be
+    // created again, by filename (their watch descriptor is -1)
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::unordered_map<::std::string, Watch> m_pending;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Watch descriptors of the parent directories of the watched files
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::unordered_set<int> m_directories;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reusable buffer receiving the changed bytes
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::string m_buffer;
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using FileWatcher = ::xrn::util::FileWatcher; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/FileWatcher.impl.hpp>
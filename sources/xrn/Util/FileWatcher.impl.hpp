@@ -0,0 +1,338 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::FileWatcher::FileWatcher()
+    : m_fd{ ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC) }
+{
+    if (!m_fd.isValid()) {
+        throw ::std::system_error{ errno, ::std::generic_category(), "inotify_init1" };
+    }
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileWatcher::watch(
+    const ::std::string& filename
+    , Callback callback
+)
+{
+    if (auto it{ m_descriptors.find(filename) }; it != m_descriptors.end()) {
+        auto& watch{ it->second == -1 ? m_pending.at(filename) : m_watches.at(it->second) };
+        watch.callbacks.push_back(::std::move(callback));
+        return;
+    }
+
+    ::xrn::util::FileDescriptor fd{ filename, O_RDONLY };
+    struct ::stat status;
+    if (::fstat(fd.get(), &status) == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), filename };
+    }
+    const auto wd{ this->addWatch(filename) };
+    if (wd == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), filename };
+    }
+
+    // another path to the same file shares its watch descriptor
+    auto [it, isInserted]{ m_watches.try_emplace(wd) };
+    if (isInserted) {
+        it->second.filename = filename;
+        it->second.directory = this->addDirectoryWatch(filename);
+        FileWatcher::snapshot(it->second, fd, status);
+    }
+    it->second.callbacks.push_back(::std::move(callback));
+    m_descriptors.emplace(filename, wd);
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileWatcher::unwatch(
+    const ::std::string& filename
+)
+{
+    auto it{ m_descriptors.find(filename) };
+    if (it == m_descriptors.end()) {
+        return;
+    }
+    const auto wd{ it->second };
+    if (wd == -1) {
+        m_pending.erase(filename);
+        m_descriptors.erase(it);
+    } else {
+        ::inotify_rm_watch(m_fd.get(), wd);
+        m_watches.erase(wd);
+        ::std::erase_if(m_descriptors, [wd](const auto& descriptor){ return descriptor.second == wd; });
+    }
+    this->removeUnusedDirectoryWatches();
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileWatcher::poll(
+    int timeout
+) -> ::std::size_t
+{
+    ::pollfd pollFd{ m_fd.get(), POLLIN, 0 };
+    int ready;
+    do {
+        ready = ::poll(&pollFd, 1, timeout);
+    } while (ready == -1 && errno == EINTR);
+    if (ready == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), "poll" };
+    }
+    if (ready == 0) {
+        return 0;
+    }
+
+    // events are gathered first so a file modified many times is read once
+    ::std::vector<int> modified;
+    ::std::vector<int> replaced;
+    ::std::vector<::std::string> created;
+    alignas(::inotify_event) char buffer[4096];
+    while (true) {
+        const auto amount{ ::read(m_fd.get(), buffer, sizeof(buffer)) };
+        if (amount == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN) {
+                break;
+            }
+            throw ::std::system_error{ errno, ::std::generic_category(), "inotify" };
+        }
+        for (auto i{ 0z }; i < amount;) {
+            const auto* event{ reinterpret_cast<const ::inotify_event*>(buffer + i) };
+            if (m_directories.contains(event->wd)) {
+                if (event->mask & IN_IGNORED) {
+                    m_directories.erase(event->wd);
+                } else if (event->len) {
+                    for (const auto& [filename, watch] : m_pending) {
+                        if (
+                            watch.directory == event->wd &&
+                            ::std::filesystem::path{ filename }.filename() == event->name
+                        ) {
+                            created.push_back(filename);
+                        }
+                    }
+                }
+            } else if (event->mask & (IN_MOVE_SELF | IN_DELETE_SELF | IN_IGNORED)) {
+                replaced.push_back(event->wd);
+            } else {
+                modified.push_back(event->wd);
+            }
+            i += static_cast<::ssize_t>(sizeof(::inotify_event) + event->len);
+        }
+    }
+
+    // the path now refers to another file (or nothing until it is created
+    // again), other paths to the file are not followed anymore
+    ::std::ranges::sort(replaced);
+    replaced.erase(::std::ranges::unique(replaced).begin(), replaced.end());
+    for (const auto wd : replaced) {
+        auto node{ m_watches.extract(wd) };
+        if (node.empty()) {
+            continue;
+        }
+        ::inotify_rm_watch(m_fd.get(), wd);
+        const auto& filename{ node.mapped().filename };
+        ::std::erase_if(m_descriptors, [wd, &filename](const auto& descriptor){
+            return descriptor.second == wd && descriptor.first != filename;
+        });
+        m_descriptors.at(filename) = -1;
+        created.push_back(filename);
+        m_pending.emplace(filename, ::std::move(node.mapped()));
+    }
+    if (!replaced.empty()) {
+        this->removeUnusedDirectoryWatches();
+    }
+
+    // watched from scratch once the path exists again
+    ::std::ranges::sort(created);
+    created.erase(::std::ranges::unique(created).begin(), created.end());
+    for (const auto& filename : created) {
+        auto pending{ m_pending.find(filename) };
+        if (pending == m_pending.end()) {
+            continue;
+        }
+        const auto wd{ this->addWatch(filename) };
+        if (wd == -1) {
+            continue;
+        }
+        auto watch{ ::std::move(pending->second) };
+        m_pending.erase(pending);
+        m_descriptors.at(filename) = wd;
+        if (auto existing{ m_watches.find(wd) }; existing != m_watches.end()) {
+            // another watched path to the same file
+            ::std::ranges::move(watch.callbacks, ::std::back_inserter(existing->second.callbacks));
+            continue;
+        }
+        watch.size = 0;
+        watch.modificationTime = {};
+        watch.tail.clear();
+        m_watches.emplace(wd, ::std::move(watch));
+        modified.push_back(wd);
+    }
+
+    ::std::ranges::sort(modified);
+    modified.erase(::std::ranges::unique(modified).begin(), modified.end());
+    ::std::size_t count{ 0 };
+    for (const auto wd : modified) {
+        if (auto watch{ m_watches.find(wd) }; watch != m_watches.end()) {
+            count += this->reload(watch->second);
+        }
+    }
+    return count;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Getters
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileWatcher::getFd() const noexcept
+    -> int
+{
+    return m_fd.get();
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileWatcher::isWatched(
+    const ::std::string& filename
+) const
+    -> bool
+{
+    return m_descriptors.contains(filename);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileWatcher::addWatch(
+    const ::std::string& filename
+) noexcept
+    -> int
+{
+    return ::inotify_add_watch(
+        m_fd.get()
+        , filename.c_str()
+        , IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileWatcher::addDirectoryWatch(
+    const ::std::string& filename
+) -> int
+{
+    const auto directory{ ::std::filesystem::path{ filename }.parent_path() };
+    const auto wd{ ::inotify_add_watch(
+        m_fd.get()
+        , directory.empty() ? "." : directory.c_str()
+        , IN_CREATE | IN_MOVED_TO | IN_ONLYDIR
+    ) };
+    if (wd != -1) {
+        m_directories.insert(wd);
+    }
+    return wd;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileWatcher::removeUnusedDirectoryWatches() noexcept
+{
+    const auto isUsed{ [this](int wd){
+        const auto isInDirectory{ [wd](const auto& watch){ return watch.second.directory == wd; } };
+        return ::std::ranges::any_of(m_watches, isInDirectory) || ::std::ranges::any_of(m_pending, isInDirectory);
+    } };
+    ::std::erase_if(m_directories, [this, &isUsed](int wd){
+        if (isUsed(wd)) {
+            return false;
+        }
+        ::inotify_rm_watch(m_fd.get(), wd);
+        return true;
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileWatcher::snapshot(
+    Watch& watch
+    , const ::xrn::util::FileDescriptor& fd
+    , const struct ::stat& status
+)
+{
+    watch.size = static_cast<::std::size_t>(status.st_size);
+    watch.modificationTime = status.st_mtim;
+    const auto tailSize{ ::std::min(watch.size, FileWatcher::tailSize) };
+    watch.tail.resize(tailSize);
+    watch.tail.resize(fd.readAt(watch.tail.data(), tailSize, watch.size - tailSize));
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileWatcher::reload(
+    Watch& watch
+) -> bool
+{
+    ::xrn::util::FileDescriptor fd;
+    try {
+        fd = ::xrn::util::FileDescriptor{ watch.filename, O_RDONLY };
+    } catch (const ::std::system_error&) {
+        return false; // removed, a replacement triggers another event
+    }
+    struct ::stat status;
+    if (::fstat(fd.get(), &status) == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), watch.filename };
+    }
+    const auto size{ static_cast<::std::size_t>(status.st_size) };
+    if (
+        size == watch.size &&
+        status.st_mtim.tv_sec == watch.modificationTime.tv_sec &&
+        status.st_mtim.tv_nsec == watch.modificationTime.tv_nsec
+    ) {
+        return false;
+    }
+
+    // appended only if the file grew and its previous end is untouched, a
+    // rewrite of the same size is read again
+    ::std::size_t offset{ 0 };
+    if (size > watch.size && watch.size) {
+        char tail[FileWatcher::tailSize];
+        const auto tailOffset{ watch.size - watch.tail.size() };
+        const auto amount{ fd.readAt(tail, watch.tail.size(), tailOffset) };
+        if (::std::string_view{ tail, amount } == watch.tail) {
+            offset = watch.size;
+        }
+    }
+
+    m_buffer.resize(size - offset);
+    m_buffer.resize(fd.readAt(m_buffer.data(), m_buffer.size(), offset));
+    FileWatcher::snapshot(watch, fd, status);
+
+    const Change change{ watch.filename, m_buffer, offset, offset != 0 };
+    for (const auto& callback : watch.callbacks) {
+        callback(change);
+    }
+    return true;
+}
@@ -0,0 +1,337 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <sys/uio.h>
+#include <sys/stat.h>
+#include <sys/xattr.h>
+#include <fcntl.h>
+#include <xrn/Util/FileDescriptor.hpp>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Writes a file through a large buffer
+/// \ingroup util
+///
+/// \include FileWriter.hpp <xrn/Util/FileWriter.hpp>
+///
+/// ::xrn::util::FileWriter gathers small writes in a user-space buffer and
+/// writes big ones directly, together with the buffered bytes, in a single
+/// writev() call. The file can be preallocated to avoid fragmentation.
+/// In atomic mode, the content is written to a temporary file in the same
+/// directory that replaces the destination on commit(): readers see either
+/// the previous content or the new one, never a partial file. The
+/// replacement keeps the permissions, owner and ACL of the destination.
+///
+/// Usage example:
+/// \code
+/// ::xrn::File::Writer writer{ "filepath", ::xrn::File::Writer::Mode::atomic };
+/// writer.write("header\n");
+/// writer.write(::std::array<::std::string_view, 3>{ key, "=", value });
+/// writer.commit();
+/// \endcode
+///
+/// \see ::xrn::util::File
+///
+///////////////////////////////////////////////////////////////////////////
+class FileWriter {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default size of the buffer in bytes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ::std::size_t defaultBufferSize{ 1024 * 1024 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief How the destination is written
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Mode : ::std::uint8_t {
+        truncate, ///< Replaces the content of the file
+        append, ///< Writes after the content of the file
+        atomic, ///< Replaces the file on commit(), discarded if not committed
+    };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Opens (and creates if needed) the file to write
+    ///
+    /// \param filename Path of the file to write
+    /// \param mode How the file is written
+    /// \param bufferSize Size of the buffer
+    /// \param preallocatedSize Bytes reserved on disk upfront if the file
+    ///        system supports it, the size of the file is not changed
+    ///
+    /// \throws ::std::system_error if the file cannot be opened
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline FileWriter(
+        const ::std::string& filename
+        , FileWriter::Mode mode = FileWriter::Mode::truncate
+        , ::std::size_t bufferSize = FileWriter::defaultBufferSize
+        , ::std::size_t preallocatedSize = 0
+    );
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Rule of 5
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// If commit() was not called, the buffer is flushed (errors are
+    /// ignored) or, in atomic mode, the temporary file is removed.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline ~FileWriter();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy constructor deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    FileWriter(
+        const FileWriter& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        const FileWriter& that
+    ) noexcept
+        -> FileWriter& = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline FileWriter(
+        FileWriter&& that
+    ) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        FileWriter&& that
+    ) noexcept
+        -> FileWriter& = delete;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Writes bytes
+    ///
+    /// \throws ::std::system_error if writing fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void write(
+        const void* data
+        , ::std::size_t size
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Writes a string
+    ///
+    /// \throws ::std::system_error if writing fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void write(
+        ::std::string_view content
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Writes bytes
+    ///
+    /// \throws ::std::system_error if writing fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void write(
+        ::std::span<const ::std::byte> content
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Writes pieces one after the other
+    ///
+    /// Pieces are copied to the buffer if they fit in it, otherwise the
+    /// buffer and the pieces are written by a single writev().
+    ///
+    /// \throws ::std::system_error if writing fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void write(
+        ::std::span<const ::std::string_view> pieces
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Writes the content of the buffer to the file
+    ///
+    /// \throws ::std::system_error if writing fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void flush();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Flushes and closes the file
+    ///
+    /// In atomic mode, the temporary file is synced to the disk then renamed
+    /// over the destination, and the directory is synced so the rename
+    /// survives a power loss.
+    ///
+    /// \throws ::std::system_error if writing, syncing or renaming fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void commit();
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of bytes written so far, buffered ones included
+    ///
+    /// After a failed write, only the bytes that reached the file or the
+    /// buffer are counted.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getWrittenSize() const noexcept
+        -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the file is still open
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto isOpen() const noexcept
+        -> bool;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Writes every vector, retrying on EINTR and partial writes
+    ///
+    /// vectors is modified: if writing fails, each vector is left with the
+    /// part of it that was not written.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void writeVectors(
+        ::std::span<::iovec> vectors
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Writes the buffer, given as the first vector, followed by the
+    ///        other vectors
+    ///
+    /// If writing fails, what is left of the buffer stays buffered so it is
+    /// neither lost nor written twice, and only the bytes of the other
+    /// vectors that reached the file are counted as written.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void writeBuffered(
+        ::std::span<::iovec> vectors
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gives the temporary file the permissions, owner and ACL of the
+    ///        destination, if it exists
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void copyAttributes();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Syncs the directory of the destination to the disk
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void syncDirectory();
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Destination, and temporary file written in atomic mode
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::string m_filename;
+    ::std::string m_temporaryFilename;
+    ::xrn::util::FileDescriptor m_fd;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Buffered bytes are [0, m_used) in m_buffer
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::unique_ptr<char[]> m_buffer;
+    ::std::size_t m_bufferSize;
+    ::std::size_t m_used{ 0 };
+    ::std::size_t m_written{ 0 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reusable vectors given to writev()
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::vector<::iovec> m_vectors;
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using FileWriter = ::xrn::util::FileWriter; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/FileWriter.impl.hpp>
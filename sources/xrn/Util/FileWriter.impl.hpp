@@ -0,0 +1,337 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::FileWriter::FileWriter(
+    const ::std::string& filename
+    , FileWriter::Mode mode
+    , ::std::size_t bufferSize
+    , ::std::size_t preallocatedSize
+)
+    : m_filename{ filename }
+    , m_bufferSize{ ::std::max(bufferSize, 1uz) }
+{
+    switch (mode) {
+    case FileWriter::Mode::truncate:
+        m_fd = ::xrn::util::FileDescriptor{ filename, O_WRONLY | O_CREAT | O_TRUNC };
+        break;
+    case FileWriter::Mode::append:
+        m_fd = ::xrn::util::FileDescriptor{ filename, O_WRONLY | O_CREAT | O_APPEND };
+        break;
+    case FileWriter::Mode::atomic: {
+        // same directory as the destination so rename() cannot cross devices
+        static ::std::atomic<unsigned> counter{ 0 };
+        m_temporaryFilename = ::fmt::format("{}.{}.{}.tmp", filename, ::getpid(), counter++);
+        m_fd = ::xrn::util::FileDescriptor{ m_temporaryFilename, O_WRONLY | O_CREAT | O_EXCL };
+        try {
+            this->copyAttributes();
+        } catch (const ::std::system_error&) {
+            m_fd.close();
+            ::unlink(m_temporaryFilename.c_str());
+            throw;
+        }
+        break;
+    }
+    }
+
+    if (preallocatedSize) {
+        // only a hint, unsupported by some file systems
+        const auto offset{ (mode == FileWriter::Mode::append) ? m_fd.getSize() : 0 };
+        ::fallocate(
+            m_fd.get()
+            , FALLOC_FL_KEEP_SIZE
+            , static_cast<::off_t>(offset)
+            , static_cast<::off_t>(preallocatedSize)
+        );
+    }
+    m_buffer = ::std::make_unique_for_overwrite<char[]>(m_bufferSize);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Rule of 5
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::FileWriter::~FileWriter()
+{
+    if (!m_fd.isValid()) {
+        return;
+    }
+    if (!m_temporaryFilename.empty()) {
+        m_fd.close();
+        ::unlink(m_temporaryFilename.c_str());
+        return;
+    }
+    try {
+        this->flush();
+    } catch (const ::std::system_error&) {
+        // nowhere to report it, commit() must be called to handle errors
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::FileWriter::FileWriter(
+    FileWriter&& that
+) noexcept
+    : m_filename{ ::std::move(that.m_filename) }
+    , m_temporaryFilename{ ::std::move(that.m_temporaryFilename) }
+    , m_fd{ ::std::move(that.m_fd) }
+    , m_buffer{ ::std::move(that.m_buffer) }
+    , m_bufferSize{ that.m_bufferSize }
+    , m_used{ ::std::exchange(that.m_used, 0) }
+    , m_written{ that.m_written }
+    , m_vectors{ ::std::move(that.m_vectors) }
+{}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileWriter::write(
+    const void* data
+    , ::std::size_t size
+)
+{
+    if (size <= m_bufferSize - m_used) {
+        ::std::memcpy(m_buffer.get() + m_used, data, size);
+        m_used += size;
+        m_written += size;
+    } else if (size < m_bufferSize) {
+        this->flush();
+        ::std::memcpy(m_buffer.get(), data, size);
+        m_used = size;
+        m_written += size;
+    } else {
+        // too big to be worth a copy
+        ::iovec vectors[2]{
+            { m_buffer.get(), m_used }
+            , { const_cast<void*>(data), size }
+        };
+        this->writeBuffered(vectors);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileWriter::write(
+    ::std::string_view content
+)
+{
+    this->write(content.data(), content.size());
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileWriter::write(
+    ::std::span<const ::std::byte> content
+)
+{
+    this->write(content.data(), content.size());
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileWriter::write(
+    ::std::span<const ::std::string_view> pieces
+)
+{
+    ::std::size_t size{ 0 };
+    for (const auto piece : pieces) {
+        size += piece.size();
+    }
+
+    if (size <= m_bufferSize - m_used) {
+        for (const auto piece : pieces) {
+            ::std::memcpy(m_buffer.get() + m_used, piece.data(), piece.size());
+            m_used += piece.size();
+        }
+        m_written += size;
+    } else {
+        m_vectors.clear();
+        m_vectors.push_back({ m_buffer.get(), m_used });
+        for (const auto piece : pieces) {
+            m_vectors.push_back({ const_cast<char*>(piece.data()), piece.size() });
+        }
+        this->writeBuffered(m_vectors);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileWriter::flush()
+{
+    if (m_used) {
+        ::iovec vector{ m_buffer.get(), m_used };
+        this->writeBuffered({ &vector, 1 });
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileWriter::commit()
+{
+    this->flush();
+    if (m_temporaryFilename.empty()) {
+        m_fd.close();
+        return;
+    }
+
+    // the content must reach the disk before the rename does
+    if (::fdatasync(m_fd.get()) == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), m_temporaryFilename };
+    }
+    m_fd.close();
+    if (::rename(m_temporaryFilename.c_str(), m_filename.c_str()) == -1) {
+        const auto error{ errno };
+        ::unlink(m_temporaryFilename.c_str());
+        throw ::std::system_error{ error, ::std::generic_category(), m_filename };
+    }
+    m_temporaryFilename.clear();
+    this->syncDirectory();
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Getters
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileWriter::getWrittenSize() const noexcept
+    -> ::std::size_t
+{
+    return m_written;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::FileWriter::isOpen() const noexcept
+    -> bool
+{
+    return m_fd.isValid();
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileWriter::writeVectors(
+    ::std::span<::iovec> vectors
+)
+{
+    auto* it{ vectors.data() };
+    auto* const last{ vectors.data() + vectors.size() };
+    while (it != last) {
+        const auto count{ static_cast<int>(::std::min(last - it, ::std::ptrdiff_t{ IOV_MAX })) };
+        auto amount{ ::writev(m_fd.get(), it, count) };
+        if (amount == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw ::std::system_error{ errno, ::std::generic_category(), "writev" };
+        }
+        // skips what was written, the last vector may be partially written
+        while (it != last && static_cast<::std::size_t>(amount) >= it->iov_len) {
+            amount -= static_cast<::ssize_t>(it->iov_len);
+            it->iov_len = 0;
+            ++it;
+        }
+        if (it != last) {
+            it->iov_base = static_cast<char*>(it->iov_base) + amount;
+            it->iov_len -= static_cast<::std::size_t>(amount);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileWriter::writeBuffered(
+    ::std::span<::iovec> vectors
+)
+{
+    ::std::size_t size{ 0 };
+    for (const auto& vector : vectors.subspan(1)) {
+        size += vector.iov_len;
+    }
+
+    try {
+        this->writeVectors(vectors);
+    } catch (...) {
+        // the written part of the buffer is dropped, the rest moves to its
+        // front
+        const auto& buffer{ vectors.front() };
+        ::std::memmove(m_buffer.get(), buffer.iov_base, buffer.iov_len);
+        m_used = buffer.iov_len;
+        for (const auto& vector : vectors.subspan(1)) {
+            size -= vector.iov_len;
+        }
+        m_written += size;
+        throw;
+    }
+    m_used = 0;
+    m_written += size;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileWriter::copyAttributes()
+{
+    struct ::stat status;
+    if (::stat(m_filename.c_str(), &status) == -1) {
+        if (errno == ENOENT) {
+            return; // created with the default permissions, the umask applies
+        }
+        throw ::std::system_error{ errno, ::std::generic_category(), m_filename };
+    }
+
+    // the owner can only be given by a privileged process, keeping the group
+    // may still be allowed. Changing the owner clears the set-id bits, so the
+    // mode is set after
+    if (::fchown(m_fd.get(), status.st_uid, status.st_gid) == -1) {
+        ::fchown(m_fd.get(), static_cast<::uid_t>(-1), status.st_gid);
+    }
+    if (::fchmod(m_fd.get(), status.st_mode & 07777) == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), m_temporaryFilename };
+    }
+
+    // without ACL support, the permissions are all there is to keep
+    char acl[4096];
+    const auto size{ ::getxattr(m_filename.c_str(), "system.posix_acl_access", acl, sizeof(acl)) };
+    if (size > 0) {
+        ::fsetxattr(m_fd.get(), "system.posix_acl_access", acl, static_cast<::std::size_t>(size), 0);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::FileWriter::syncDirectory()
+{
+    const auto directory{ ::std::filesystem::path{ m_filename }.parent_path() };
+    auto fd{ ::xrn::util::FileDescriptor::open(
+        directory.empty() ? "." : directory.string()
+        , O_RDONLY | O_DIRECTORY
+    ) };
+    if (!fd) {
+        throw ::std::system_error{ fd.error(), directory.string() };
+    }
+    if (::fsync(fd->get()) == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), directory.string() };
+    }
+}
@@ -0,0 +1,288 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/io_uring.h>
+#include <xrn/Util/FileDescriptor.hpp>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Minimal io_uring instance submitting reads and statx
+/// \ingroup util
+///
+/// \include IoUring.hpp <xrn/Util/IoUring.hpp>
+///
+/// ::xrn::util::IoUring sets up the submission and completion rings of an
+/// io_uring through raw system calls (no liburing dependency) and exposes
+/// just enough to queue reads or statx in batches and reap their
+/// completions.
+/// It is not thread safe and is mostly used by ::xrn::util::BatchReader and
+/// ::xrn::util::DirectoryScanner.
+///
+/// Usage example:
+/// \code
+/// ::xrn::IoUring ring{ 64 };
+/// ring.prepareRead(fd, buffer, size, 0, userData);
+/// ring.submit(1);
+/// ring.forEachCompletion([](::std::uint64_t userData, int result){ ... });
+/// \endcode
+///
+/// \see ::xrn::util::BatchReader, ::xrn::util::DirectoryScanner
+///
+///////////////////////////////////////////////////////////////////////////
+class IoUring {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sets up an io_uring instance
+    ///
+    /// \param entries Size of the submission queue (rounded up to a power of
+    ///        two by the kernel)
+    ///
+    /// \throws ::std::system_error if io_uring is not available (old kernels,
+    ///         seccomp filters, ...)
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline IoUring(
+        unsigned entries
+    );
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Rule of 5
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Unmaps the rings and closes the instance.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline ~IoUring();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy constructor deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    IoUring(
+        const IoUring& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        const IoUring& that
+    ) noexcept
+        -> IoUring& = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move constructor deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    IoUring(
+        IoUring&& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        IoUring&& that
+    ) noexcept
+        -> IoUring& = delete;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Queues a read, nothing is sent to the kernel before submit()
+    ///
+    /// \return False if the submission queue is full
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto prepareRead(
+        int fd
+        , void* buffer
+        , unsigned size
+        , ::std::uint64_t offset
+        , ::std::uint64_t userData
+    ) noexcept
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Queues a statx(), nothing is sent to the kernel before submit()
+    ///
+    /// path and status must stay valid until the completion is consumed.
+    /// The result of the completion is 0 or -errno.
+    ///
+    /// \return False if the submission queue is full
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto prepareStatx(
+        int directoryFd
+        , const char* path
+        , int flags
+        , unsigned mask
+        , struct ::statx* status
+        , ::std::uint64_t userData
+    ) noexcept
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sends the queued requests to the kernel
+    ///
+    /// \param minCompletions Blocks until at least this amount of requests
+    ///        are completed
+    ///
+    /// \throws ::std::system_error if io_uring_enter() fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void submit(
+        unsigned minCompletions = 0
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Consumes every available completion
+    ///
+    /// callback is called with the user data given when preparing and the
+    /// result of the request (amount of bytes read for a read, or -errno).
+    ///
+    /// \return Amount of completions consumed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto forEachCompletion(
+        auto&& callback
+    ) -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of requests that can be in flight at once
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getCapacity() const noexcept
+        -> unsigned;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the kernel supports an operation
+    ///
+    /// Kernels without IORING_REGISTER_PROBE (before 5.6) are considered not
+    /// to support any operation, IORING_OP_READ came with the same version.
+    ///
+    /// \param opcode IORING_OP_* constant
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto isSupported(
+        ::std::uint8_t opcode
+    ) const
+        -> bool;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copies a request into the submission queue
+    ///
+    /// \return False if the submission queue is full
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto prepare(
+        const ::io_uring_sqe& sqe
+    ) noexcept
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Unmaps every ring mapped
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void unmap() noexcept;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // io_uring instance
+    ///////////////////////////////////////////////////////////////////////////
+    ::xrn::util::FileDescriptor m_fd;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Mapped rings, the completion ring may share the submission mapping
+    ///////////////////////////////////////////////////////////////////////////
+    void* m_sqRing{ MAP_FAILED };
+    ::std::size_t m_sqRingSize{ 0 };
+    void* m_cqRing{ MAP_FAILED };
+    ::std::size_t m_cqRingSize{ 0 };
+    ::io_uring_sqe* m_sqes{ static_cast<::io_uring_sqe*>(MAP_FAILED) };
+    ::std::size_t m_sqesSize{ 0 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Pointers inside the rings
+    ///////////////////////////////////////////////////////////////////////////
+    unsigned* m_sqTail{ nullptr };
+    unsigned* m_sqHead{ nullptr };
+    unsigned m_sqMask{ 0 };
+    unsigned m_sqEntries{ 0 };
+    unsigned* m_sqArray{ nullptr };
+    unsigned* m_cqHead{ nullptr };
+    unsigned* m_cqTail{ nullptr };
+    unsigned m_cqMask{ 0 };
+    ::io_uring_cqe* m_cqes{ nullptr };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Requests prepared but not submitted yet
+    ///////////////////////////////////////////////////////////////////////////
+    unsigned m_pending{ 0 };
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using IoUring = ::xrn::util::IoUring; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/IoUring.impl.hpp>
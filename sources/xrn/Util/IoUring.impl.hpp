@@ -0,0 +1,237 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::IoUring::IoUring(
+    unsigned entries
+)
+{
+    ::io_uring_params params{};
+    const auto fd{ static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params)) };
+    if (fd < 0) {
+        throw ::std::system_error{ errno, ::std::generic_category(), "io_uring_setup" };
+    }
+    m_fd = ::xrn::util::FileDescriptor{ fd };
+
+    m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(::io_uring_cqe);
+    const bool isSingleMapping{ (params.features & IORING_FEAT_SINGLE_MMAP) != 0 };
+    if (isSingleMapping) {
+        m_sqRingSize = m_cqRingSize = ::std::max(m_sqRingSize, m_cqRingSize);
+    }
+
+    const auto mapRing{ [fd](::std::size_t size, ::off_t offset){
+        return ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+    } };
+    m_sqRing = mapRing(m_sqRingSize, static_cast<::off_t>(IORING_OFF_SQ_RING));
+    if (m_sqRing != MAP_FAILED) {
+        m_cqRing = isSingleMapping
+            ? m_sqRing
+            : mapRing(m_cqRingSize, static_cast<::off_t>(IORING_OFF_CQ_RING));
+    }
+    if (m_cqRing != MAP_FAILED) {
+        m_sqesSize = params.sq_entries * sizeof(::io_uring_sqe);
+        m_sqes = static_cast<::io_uring_sqe*>(mapRing(m_sqesSize, static_cast<::off_t>(IORING_OFF_SQES)));
+    }
+    if (m_sqes == MAP_FAILED) {
+        const int error{ errno };
+        this->unmap();
+        throw ::std::system_error{ error, ::std::generic_category(), "io_uring mmap" };
+    }
+
+    auto* sq{ static_cast<char*>(m_sqRing) };
+    m_sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    m_sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    m_sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    m_sqEntries = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_entries);
+    m_sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+    auto* cq{ static_cast<char*>(m_cqRing) };
+    m_cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    m_cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    m_cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    m_cqes = reinterpret_cast<::io_uring_cqe*>(cq + params.cq_off.cqes);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Rule of 5
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::IoUring::~IoUring()
+{
+    this->unmap();
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::IoUring::prepareRead(
+    int fd
+    , void* buffer
+    , unsigned size
+    , ::std::uint64_t offset
+    , ::std::uint64_t userData
+) noexcept
+    -> bool
+{
+    ::io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_READ;
+    sqe.fd = fd;
+    sqe.addr = reinterpret_cast<::std::uint64_t>(buffer);
+    sqe.len = size;
+    sqe.off = offset;
+    sqe.user_data = userData;
+    return this->prepare(sqe);
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::IoUring::prepareStatx(
+    int directoryFd
+    , const char* path
+    , int flags
+    , unsigned mask
+    , struct ::statx* status
+    , ::std::uint64_t userData
+) noexcept
+    -> bool
+{
+    ::io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_STATX;
+    sqe.fd = directoryFd;
+    sqe.addr = reinterpret_cast<::std::uint64_t>(path);
+    sqe.len = mask;
+    sqe.addr2 = reinterpret_cast<::std::uint64_t>(status);
+    sqe.statx_flags = static_cast<::std::uint32_t>(flags);
+    sqe.user_data = userData;
+    return this->prepare(sqe);
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::IoUring::submit(
+    unsigned minCompletions
+)
+{
+    const unsigned flags{ minCompletions ? IORING_ENTER_GETEVENTS : 0u };
+    while (true) {
+        const auto submitted{ ::syscall(
+            __NR_io_uring_enter, m_fd.get(), m_pending, minCompletions, flags, nullptr, 0
+        ) };
+        if (submitted < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw ::std::system_error{ errno, ::std::generic_category(), "io_uring_enter" };
+        }
+        m_pending -= static_cast<unsigned>(submitted);
+        return;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::IoUring::forEachCompletion(
+    auto&& callback
+) -> ::std::size_t
+{
+    // the head is only written by this side of the ring, the tail by the kernel
+    auto head{ *m_cqHead };
+    const auto tail{ ::std::atomic_ref<unsigned>{ *m_cqTail }.load(::std::memory_order::acquire) };
+    ::std::size_t amount{ 0 };
+    for (; head != tail; ++amount) {
+        const auto cqe{ m_cqes[head & m_cqMask] };
+        ::std::atomic_ref<unsigned>{ *m_cqHead }.store(++head, ::std::memory_order::release);
+        callback(cqe.user_data, cqe.res);
+    }
+    return amount;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::IoUring::getCapacity() const noexcept
+    -> unsigned
+{
+    return m_sqEntries;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::IoUring::isSupported(
+    ::std::uint8_t opcode
+) const
+    -> bool
+{
+    // the probe ends with a flexible array of operations
+    constexpr unsigned operationCount{ 256 };
+    ::std::vector<::std::byte> buffer(
+        sizeof(::io_uring_probe) + operationCount * sizeof(::io_uring_probe_op)
+    );
+    auto* probe{ reinterpret_cast<::io_uring_probe*>(buffer.data()) };
+    if (::syscall(__NR_io_uring_register, m_fd.get(), IORING_REGISTER_PROBE, probe, operationCount) < 0) {
+        return false;
+    }
+    return opcode <= probe->last_op && (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::IoUring::prepare(
+    const ::io_uring_sqe& sqe
+) noexcept
+    -> bool
+{
+    // the tail is only written by this side of the ring, the head by the kernel
+    const auto head{ ::std::atomic_ref<unsigned>{ *m_sqHead }.load(::std::memory_order::acquire) };
+    const auto tail{ *m_sqTail };
+    if (tail - head >= m_sqEntries) {
+        return false;
+    }
+
+    const auto index{ tail & m_sqMask };
+    m_sqes[index] = sqe;
+    m_sqArray[index] = index;
+
+    ::std::atomic_ref<unsigned>{ *m_sqTail }.store(tail + 1, ::std::memory_order::release);
+    ++m_pending;
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::IoUring::unmap() noexcept
+{
+    if (m_sqes != MAP_FAILED) {
+        ::munmap(m_sqes, m_sqesSize);
+        m_sqes = static_cast<::io_uring_sqe*>(MAP_FAILED);
+    }
+    if (m_cqRing != MAP_FAILED && m_cqRing != m_sqRing) {
+        ::munmap(m_cqRing, m_cqRingSize);
+    }
+    m_cqRing = MAP_FAILED;
+    if (m_sqRing != MAP_FAILED) {
+        ::munmap(m_sqRing, m_sqRingSize);
+        m_sqRing = MAP_FAILED;
+    }
+}
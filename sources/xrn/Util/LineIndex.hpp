@@ -0,0 +1,306 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <sys/stat.h>
+#include <xrn/Util/FileDescriptor.hpp>
+#include <xrn/Util/MappedFile.hpp>
+#include <xrn/Util/ByteScanner.hpp>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Persistent index of the lines of a file
+/// \ingroup util
+///
+/// \include LineIndex.hpp <xrn/Util/LineIndex.hpp>
+///
+/// ::xrn::util::LineIndex stores the line offsets of a file in a sidecar
+/// file ("<filename>.lidx" by default) so huge files are only scanned once.
+/// Reading a line then costs a single pread() of that line.
+/// The index is memory mapped when loaded and rebuilt automatically when
+/// the size or the modification time of the file changed.
+///
+/// Index format (native endianness):
+/// - a header holding the state of the indexed file,
+/// - a checkpoint every blockSize lines: absolute offset of the line and
+///   position of the next delta in the stream,
+/// - a stream of the offset deltas between the checkpoints, as LEB128
+///   varints (usually one byte per line).
+///
+/// Lines are split on "\n" or "\r\n".
+///
+/// Usage example:
+/// \code
+/// ::xrn::LineIndex index{ "filepath" };
+/// auto line{ index.getLine(1'000'000) };
+/// \endcode
+///
+/// \see ::xrn::util::BasicLineTable to index a file in memory
+///
+///////////////////////////////////////////////////////////////////////////
+class LineIndex {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of lines between two checkpoints, bounds the amount of
+    ///        varints decoded per lookup
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ::std::size_t blockSize{ 64 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Extension appended to the filename by default
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ::std::string_view defaultExtension{ ".lidx" };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Writes the index of a file
+    ///
+    /// The index is written to a temporary file then renamed, a concurrent
+    /// reader never sees a partial index.
+    ///
+    /// \param filename Path of the file to index
+    /// \param indexFilename Path of the index, filename + defaultExtension
+    ///        if empty
+    ///
+    /// \throws ::std::system_error if the file cannot be read or the index
+    ///         cannot be written
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static inline void build(
+        const ::std::string& filename
+        , ::std::string indexFilename = ""
+    );
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Loads the index of a file, building it if missing or outdated
+    ///
+    /// \param filename Path of the indexed file
+    /// \param indexFilename Path of the index, filename + defaultExtension
+    ///        if empty
+    ///
+    /// \throws ::std::system_error if the file cannot be read or the index
+    ///         cannot be written
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline LineIndex(
+        const ::std::string& filename
+        , ::std::string indexFilename = ""
+    );
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads a line from the indexed file
+    ///
+    /// \throws ::std::out_of_range if index is not smaller than size()
+    /// \throws ::std::system_error if reading fails
+    /// \throws ::std::runtime_error if the index is corrupted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getLine(
+        ::std::size_t index
+    ) const
+        -> ::std::string;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the indexed file is still the one described by the
+    ///        index
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto isUpToDate() const
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Rebuilds and reloads the index if the file changed
+    ///
+    /// \return Whether the index was rebuilt
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto refresh()
+        -> bool;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Byte range of a line in the file, delimiter excluded
+    ///
+    /// index must be smaller than size().
+    ///
+    /// \return Offset of the first byte and offset past the last byte
+    ///
+    /// \throws ::std::runtime_error if the index is corrupted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getRange(
+        ::std::size_t index
+    ) const
+        -> ::std::pair<::std::size_t, ::std::size_t>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of lines
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto size() const noexcept
+        -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the file contains no lines
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto empty() const noexcept
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Path of the index
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getIndexFilename() const noexcept
+        -> const ::std::string&;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Header of the index file
+    ///////////////////////////////////////////////////////////////////////////
+    struct Header {
+        char magic[8];
+        ::std::uint64_t fileSize;
+        ::std::int64_t modificationSeconds;
+        ::std::int64_t modificationNanoseconds;
+        ::std::uint64_t offsetCount;
+        ::std::uint64_t blockSize;
+        ::std::uint64_t checkpointCount;
+        ::std::uint64_t streamSize;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Checkpoint of the index file
+    ///////////////////////////////////////////////////////////////////////////
+    struct Checkpoint {
+        ::std::uint64_t offset;
+        ::std::uint64_t streamPosition;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Identifies index files, the last character is the format version
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr char magic[8]{ 'x', 'r', 'n', 'L', 'I', 'd', 'x', '1' };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether header describes the file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto isMatching(
+        const Header& header
+        , const struct ::stat& status
+    ) noexcept
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Opens the file and loads its index, building it if needed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void open();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Maps the index
+    ///
+    /// \param isCheckingFile Whether the index must match the opened file,
+    ///        an index that was just built may describe an older state of a
+    ///        file still being written
+    ///
+    /// \return False if it is missing, corrupted or outdated
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto load(
+        bool isCheckingFile
+    ) -> bool;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Paths of the indexed file and of its index
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::string m_filename;
+    ::std::string m_indexFilename;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Indexed file, kept open to read lines
+    ///////////////////////////////////////////////////////////////////////////
+    ::xrn::util::FileDescriptor m_fd;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Mapped index and views inside it
+    ///////////////////////////////////////////////////////////////////////////
+    ::xrn::util::MappedFile m_mapping;
+    Header m_header{};
+    const Checkpoint* m_checkpoints{ nullptr };
+    const ::std::uint8_t* m_stream{ nullptr };
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using LineIndex = ::xrn::util::LineIndex; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/LineIndex.impl.hpp>
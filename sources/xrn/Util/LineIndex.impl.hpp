@@ -0,0 +1,311 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// static elements
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::LineIndex::build(
+    const ::std::string& filename
+    , ::std::string indexFilename
+)
+{
+    if (indexFilename.empty()) {
+        indexFilename = filename + ::std::string{ LineIndex::defaultExtension };
+    }
+
+    // the state is taken before reading, a modification while indexing is
+    // detected on the next load
+    ::xrn::util::FileDescriptor fd{ filename, O_RDONLY };
+    struct ::stat status;
+    if (::fstat(fd.get(), &status) == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), filename };
+    }
+
+    ::std::vector<LineIndex::Checkpoint> checkpoints;
+    ::std::vector<::std::uint8_t> stream;
+    ::std::uint64_t count{ 0 };
+    ::std::uint64_t previous{ 0 };
+    const auto push{ [&](::std::uint64_t offset){
+        if (count % LineIndex::blockSize == 0) {
+            checkpoints.push_back(LineIndex::Checkpoint{ offset, stream.size() });
+        } else {
+            auto delta{ offset - previous };
+            while (delta >= 0x80) {
+                stream.push_back(static_cast<::std::uint8_t>(delta | 0x80));
+                delta >>= 7;
+            }
+            stream.push_back(static_cast<::std::uint8_t>(delta));
+        }
+        previous = offset;
+        ++count;
+    } };
+
+    if (status.st_size) {
+        const ::xrn::util::MappedFile mapping{ filename, ::xrn::util::MappedFile::Advice::sequential };
+        const char* const first{ mapping.data() };
+        const auto size{ ::std::min(mapping.size(), static_cast<::std::size_t>(status.st_size)) };
+        stream.reserve(size / 32);
+        push(0);
+        ::xrn::util::ByteScanner::forEach(first, first + size, '\n', [&](const char* it){
+            push(static_cast<::std::uint64_t>(it - first + 1));
+        });
+        if (previous != size) {
+            push(size + 1); // sentinel of a last line without delimiter
+        }
+    }
+
+    LineIndex::Header header{};
+    ::std::ranges::copy(LineIndex::magic, header.magic);
+    header.fileSize = static_cast<::std::uint64_t>(status.st_size);
+    header.modificationSeconds = status.st_mtim.tv_sec;
+    header.modificationNanoseconds = status.st_mtim.tv_nsec;
+    header.offsetCount = count;
+    header.blockSize = LineIndex::blockSize;
+    header.checkpointCount = checkpoints.size();
+    header.streamSize = stream.size();
+
+    // unique so concurrent builds of the same index do not mix their content
+    static ::std::atomic<unsigned> counter{ 0 };
+    const auto temporaryFilename{ ::fmt::format("{}.{}.{}.tmp", indexFilename, ::getpid(), counter++) };
+    ::xrn::util::FileDescriptor output{ temporaryFilename, O_WRONLY | O_CREAT | O_EXCL };
+    // a partial index (ENOSPC, EFBIG, ...) is not left behind
+    try {
+        output.write(&header, sizeof(header));
+        output.write(checkpoints.data(), checkpoints.size() * sizeof(LineIndex::Checkpoint));
+        output.write(stream.data(), stream.size());
+        if (::rename(temporaryFilename.c_str(), indexFilename.c_str()) == -1) {
+            throw ::std::system_error{ errno, ::std::generic_category(), indexFilename };
+        }
+    } catch (...) {
+        ::unlink(temporaryFilename.c_str());
+        throw;
+    }
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::LineIndex::LineIndex(
+    const ::std::string& filename
+    , ::std::string indexFilename
+)
+    : m_filename{ filename }
+    , m_indexFilename{
+        indexFilename.empty()
+            ? filename + ::std::string{ LineIndex::defaultExtension }
+            : ::std::move(indexFilename)
+    }
+{
+    this->open();
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineIndex::getLine(
+    ::std::size_t index
+) const
+    -> ::std::string
+{
+    if (index >= this->size()) {
+        throw ::std::out_of_range{ "line index out of range" };
+    }
+    const auto [begin, end]{ this->getRange(index) };
+    ::std::string line(end - begin, '\0');
+    line.resize(m_fd.readAt(line.data(), line.size(), begin));
+    line.resize(::xrn::util::ByteScanner::trimCarriageReturn(line).size());
+    return line;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineIndex::isUpToDate() const
+    -> bool
+{
+    // stat() the path rather than the descriptor to notice replaced files
+    struct ::stat status;
+    return ::stat(m_filename.c_str(), &status) == 0 && LineIndex::isMatching(m_header, status);
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineIndex::refresh()
+    -> bool
+{
+    if (this->isUpToDate()) {
+        return false;
+    }
+    this->open();
+    return true;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Getters
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineIndex::getRange(
+    ::std::size_t index
+) const
+    -> ::std::pair<::std::size_t, ::std::size_t>
+{
+    // the mapping may have been corrupted since it was loaded, nothing is
+    // read past it
+    const auto corrupted{ [this]{
+        return ::std::runtime_error{ "corrupted line index: " + m_indexFilename };
+    } };
+    const auto& checkpoint{ m_checkpoints[index / LineIndex::blockSize] };
+    if (checkpoint.streamPosition > m_header.streamSize) {
+        throw corrupted();
+    }
+    const auto* it{ m_stream + checkpoint.streamPosition };
+    const auto* const last{ m_stream + m_header.streamSize };
+    const auto decode{ [&]{
+        ::std::uint64_t value{ 0 };
+        for (unsigned shift{ 0 }; it != last && shift < 64; shift += 7) {
+            const auto byte{ *it++ };
+            value |= static_cast<::std::uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        throw corrupted();
+    } };
+
+    auto begin{ checkpoint.offset };
+    for (auto i{ index % LineIndex::blockSize }; i > 0; --i) {
+        begin += decode();
+    }
+    const auto next{
+        ((index + 1) % LineIndex::blockSize == 0)
+            ? m_checkpoints[(index + 1) / LineIndex::blockSize].offset
+            : begin + decode()
+    };
+    if (next <= begin || next - 1 > m_header.fileSize) {
+        throw corrupted();
+    }
+    return { static_cast<::std::size_t>(begin), static_cast<::std::size_t>(next - 1) };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineIndex::size() const noexcept
+    -> ::std::size_t
+{
+    return m_header.offsetCount ? static_cast<::std::size_t>(m_header.offsetCount - 1) : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineIndex::empty() const noexcept
+    -> bool
+{
+    return this->size() == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineIndex::getIndexFilename() const noexcept
+    -> const ::std::string&
+{
+    return m_indexFilename;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineIndex::isMatching(
+    const Header& header
+    , const struct ::stat& status
+) noexcept
+    -> bool
+{
+    return
+        header.fileSize == static_cast<::std::uint64_t>(status.st_size) &&
+        header.modificationSeconds == status.st_mtim.tv_sec &&
+        header.modificationNanoseconds == status.st_mtim.tv_nsec;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::LineIndex::open()
+{
+    m_fd = ::xrn::util::FileDescriptor{ m_filename, O_RDONLY };
+    if (this->load(true)) {
+        return;
+    }
+    LineIndex::build(m_filename, m_indexFilename);
+    if (!this->load(false)) {
+        throw ::std::runtime_error{ "invalid line index: " + m_indexFilename };
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineIndex::load(
+    bool isCheckingFile
+) -> bool
+{
+    m_header = {};
+    m_checkpoints = nullptr;
+    m_stream = nullptr;
+    try {
+        m_mapping = ::xrn::util::MappedFile{ m_indexFilename, ::xrn::util::MappedFile::Advice::random };
+    } catch (const ::std::system_error&) {
+        return false;
+    }
+    if (m_mapping.size() < sizeof(Header)) {
+        return false;
+    }
+
+    // every offset is a line start within the file (or the sentinel past
+    // it), counts beyond are corrupted and would overflow the sizes below
+    Header header;
+    ::std::memcpy(&header, m_mapping.data(), sizeof(header));
+    if (
+        !::std::ranges::equal(header.magic, LineIndex::magic) ||
+        header.blockSize != LineIndex::blockSize ||
+        header.offsetCount == 1 ||
+        header.offsetCount > header.fileSize + 2 ||
+        header.checkpointCount > (m_mapping.size() - sizeof(Header)) / sizeof(Checkpoint) ||
+        header.checkpointCount != (header.offsetCount + LineIndex::blockSize - 1) / LineIndex::blockSize ||
+        sizeof(Header) + header.checkpointCount * sizeof(Checkpoint) + header.streamSize != m_mapping.size()
+    ) {
+        return false;
+    }
+    if (isCheckingFile) {
+        struct ::stat status;
+        if (::fstat(m_fd.get(), &status) == -1 || !LineIndex::isMatching(header, status)) {
+            return false;
+        }
+    }
+
+    // the mapping is page aligned and the header keeps the checkpoints aligned
+    m_header = header;
+    m_checkpoints = reinterpret_cast<const Checkpoint*>(m_mapping.data() + sizeof(Header));
+    m_stream = reinterpret_cast<const ::std::uint8_t*>(m_checkpoints + header.checkpointCount);
+    return true;
+}
@@ -0,0 +1,376 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <fcntl.h>
+#include <unistd.h>
+#include <xrn/Util/ByteScanner.hpp>
+#include <xrn/Util/DecompressingReader.hpp>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Lazy range over the lines of a file
+/// \ingroup util
+///
+/// \include LineReader.hpp <xrn/Util/LineReader.hpp>
+///
+/// ::xrn::util::LineReader reads a file through a single reusable buffer and
+/// yields its lines one by one as ::std::string_view, without the trailing
+/// "\n" or "\r\n". Another delimiter byte can be given to split records
+/// instead of lines, in which case no '\r' is removed.
+/// Memory usage stays constant whatever the size of the file (the buffer
+/// only grows if a single line does not fit in it) and the first line is
+/// available as soon as the first block is read.
+/// A yielded view is only valid until the next line is requested.
+/// The lines of a compressed file are read from a
+/// ::xrn::util::DecompressingReader, see
+/// ::xrn::util::File::decompressedLines().
+/// The class models ::std::ranges::input_range and is usually created by
+/// ::xrn::util::File::lines().
+///
+/// Usage example:
+/// \code
+/// for (::std::string_view line : ::xrn::File::lines("filepath")) {
+///     ...
+/// }
+/// \endcode
+///
+/// \see ::xrn::util::File
+///
+///////////////////////////////////////////////////////////////////////////
+class LineReader {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Default size of the internal buffer in bytes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ::std::size_t defaultBufferSize{ 64 * 1024 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Input iterator over the lines
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Iterator {
+
+    public:
+
+        using value_type = ::std::string_view;
+        using difference_type = ::std::ptrdiff_t;
+        using iterator_concept = ::std::input_iterator_tag;
+
+        Iterator() noexcept = default;
+
+        explicit inline Iterator(
+            LineReader& reader
+        ) noexcept;
+
+        [[ nodiscard ]] inline auto operator*() const noexcept
+            -> ::std::string_view;
+
+        inline auto operator++()
+            -> Iterator&;
+
+        inline void operator++(
+            int
+        );
+
+        [[ nodiscard ]] inline auto operator==(
+            ::std::default_sentinel_t
+        ) const noexcept
+            -> bool;
+
+    private:
+
+        LineReader* m_reader{ nullptr };
+
+    };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Opens the file, nothing is read until begin() is called
+    ///
+    /// \param filename Path of the file to read
+    /// \param bufferSize Initial size of the reusable buffer
+    /// \param delimiter Byte separating two lines
+    ///
+    /// \throws ::std::system_error if the file cannot be opened
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline LineReader(
+        const ::std::string& filename
+        , ::std::size_t bufferSize = LineReader::defaultBufferSize
+        , char delimiter = '\n'
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads the lines of the decompressed content of a file
+    ///
+    /// \param decompressor Opened reader, nothing is decompressed until
+    ///        begin() is called
+    /// \param bufferSize Initial size of the reusable buffer
+    /// \param delimiter Byte separating two lines
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline LineReader(
+        ::std::unique_ptr<::xrn::util::DecompressingReader> decompressor
+        , ::std::size_t bufferSize = LineReader::defaultBufferSize
+        , char delimiter = '\n'
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads the lines of a content already in memory
+    ///
+    /// The content becomes the buffer of the reader: nothing is copied nor
+    /// read from a file, so iterating never throws.
+    ///
+    /// \param content Bytes to split
+    /// \param delimiter Byte separating two lines
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static inline auto fromContent(
+        ::std::string content
+        , char delimiter = '\n'
+    ) noexcept
+        -> LineReader;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Rule of 5
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Closes the file.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline ~LineReader();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy constructor deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    LineReader(
+        const LineReader& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        const LineReader& that
+    ) noexcept
+        -> LineReader& = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline LineReader(
+        LineReader&& that
+    ) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        LineReader&& that
+    ) noexcept
+        -> LineReader& = delete;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Range
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads the first line and returns an iterator on it
+    ///
+    /// The range is single pass: calling begin() again continues from the
+    /// current line.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto begin()
+        -> LineReader::Iterator;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sentinel marking the end of the file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto end() const noexcept
+        -> ::std::default_sentinel_t;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Reads the next line
+    ///
+    /// \return False if the end of the file is reached
+    ///
+    /// \throws ::std::system_error if reading fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto next()
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Line read by the last call to next()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getLine() const noexcept
+        -> ::std::string_view;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Uses content as a buffer already filled up to the end of the
+    ///        file, see fromContent()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline LineReader(
+        char delimiter
+        , ::std::string content
+    ) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sets the current line, removing the '\r' of "\r\n" if lines
+    ///        are split on '\n'
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void setLine(
+        ::std::string_view line
+    ) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Moves the unconsumed bytes to the front of the buffer and reads
+    ///        as many bytes as possible after them
+    ///
+    /// \return False if nothing could be read
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto refill()
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copies up to size decompressed bytes into data
+    ///
+    /// \return Amount of bytes copied, 0 at the end of the content
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto readDecompressed(
+        char* data
+        , ::std::size_t size
+    ) -> ::std::size_t;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // File descriptor, -1 once moved from
+    ///////////////////////////////////////////////////////////////////////////
+    int m_fd{ -1 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Source of the bytes instead of m_fd for compressed files, and the
+    // part of its current chunk not copied yet
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::unique_ptr<::xrn::util::DecompressingReader> m_decompressor;
+    ::std::string_view m_decompressed;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reusable read buffer
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::string m_buffer;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Unconsumed bytes are [m_begin, m_end) in m_buffer, bytes in
+    // [m_begin, m_scanned) are known not to contain m_delimiter
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::size_t m_begin{ 0 };
+    ::std::size_t m_scanned{ 0 };
+    ::std::size_t m_end{ 0 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Current line
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::string_view m_line;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Byte separating two lines
+    ///////////////////////////////////////////////////////////////////////////
+    char m_delimiter{ '\n' };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // State of the range
+    ///////////////////////////////////////////////////////////////////////////
+    bool m_isStarted{ false };
+    bool m_isEof{ false };
+    bool m_isDone{ false };
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using LineReader = ::xrn::util::LineReader; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/LineReader.impl.hpp>
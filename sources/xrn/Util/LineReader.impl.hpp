@@ -0,0 +1,291 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Iterator
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::LineReader::Iterator::Iterator(
+    LineReader& reader
+) noexcept
+    : m_reader{ &reader }
+{}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineReader::Iterator::operator*() const noexcept
+    -> ::std::string_view
+{
+    return m_reader->getLine();
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineReader::Iterator::operator++()
+    -> Iterator&
+{
+    m_reader->next();
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::LineReader::Iterator::operator++(
+    int
+)
+{
+    ++*this;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineReader::Iterator::operator==(
+    ::std::default_sentinel_t
+) const noexcept
+    -> bool
+{
+    return !m_reader || m_reader->m_isDone;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::LineReader::LineReader(
+    const ::std::string& filename
+    , ::std::size_t bufferSize
+    , char delimiter
+)
+    : m_fd{ ::open(filename.c_str(), O_RDONLY | O_CLOEXEC) }
+    , m_buffer(::std::max(bufferSize, 1uz), '\0')
+    , m_delimiter{ delimiter }
+{
+    if (m_fd == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), filename };
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::LineReader::LineReader(
+    ::std::unique_ptr<::xrn::util::DecompressingReader> decompressor
+    , ::std::size_t bufferSize
+    , char delimiter
+)
+    : m_decompressor{ ::std::move(decompressor) }
+    , m_buffer(::std::max(bufferSize, 1uz), '\0')
+    , m_delimiter{ delimiter }
+{}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineReader::fromContent(
+    ::std::string content
+    , char delimiter
+) noexcept
+    -> LineReader
+{
+    return LineReader{ delimiter, ::std::move(content) };
+}
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::LineReader::LineReader(
+    char delimiter
+    , ::std::string content
+) noexcept
+    : m_buffer{ ::std::move(content) }
+    , m_end{ m_buffer.size() }
+    , m_delimiter{ delimiter }
+    , m_isEof{ true }
+{}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Rule of 5
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::LineReader::~LineReader()
+{
+    if (m_fd != -1) {
+        ::close(m_fd);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::LineReader::LineReader(
+    LineReader&& that
+) noexcept
+    : m_fd{ ::std::exchange(that.m_fd, -1) }
+    , m_decompressor{ ::std::move(that.m_decompressor) }
+    , m_decompressed{ that.m_decompressed }
+    , m_buffer{ ::std::move(that.m_buffer) }
+    , m_begin{ that.m_begin }
+    , m_scanned{ that.m_scanned }
+    , m_end{ that.m_end }
+    , m_line{ that.m_line }
+    , m_delimiter{ that.m_delimiter }
+    , m_isStarted{ that.m_isStarted }
+    , m_isEof{ that.m_isEof }
+    , m_isDone{ ::std::exchange(that.m_isDone, true) }
+{}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Range
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineReader::begin()
+    -> LineReader::Iterator
+{
+    if (!m_isStarted) {
+        m_isStarted = true;
+        this->next();
+    }
+    return LineReader::Iterator{ *this };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineReader::end() const noexcept
+    -> ::std::default_sentinel_t
+{
+    return ::std::default_sentinel;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineReader::next()
+    -> bool
+{
+    m_isStarted = true;
+    while (!m_isDone) {
+        const auto* first{ m_buffer.data() + m_begin };
+        const auto* last{ m_buffer.data() + m_end };
+        const auto* delimiter{
+            ::xrn::util::ByteScanner::find(m_buffer.data() + m_scanned, last, m_delimiter)
+        };
+
+        if (delimiter != last) {
+            this->setLine(::std::string_view{ first, static_cast<::std::size_t>(delimiter - first) });
+            m_begin = static_cast<::std::size_t>(delimiter - m_buffer.data()) + 1;
+            m_scanned = m_begin;
+            return true;
+        }
+        m_scanned = m_end;
+
+        if (m_isEof || !this->refill()) {
+            m_isEof = true;
+            if (m_begin == m_end) {
+                m_line = {};
+                m_isDone = true;
+                return false;
+            }
+            // last line has no trailing delimiter
+            this->setLine(::std::string_view{ m_buffer.data() + m_begin, m_end - m_begin });
+            m_begin = m_end;
+            m_scanned = m_end;
+            return true;
+        }
+    }
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineReader::getLine() const noexcept
+    -> ::std::string_view
+{
+    return m_line;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::LineReader::setLine(
+    ::std::string_view line
+) noexcept
+{
+    m_line = (m_delimiter == '\n') ? ::xrn::util::ByteScanner::trimCarriageReturn(line) : line;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineReader::refill()
+    -> bool
+{
+    if (m_begin != 0) {
+        ::std::memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+        m_end -= m_begin;
+        m_scanned -= m_begin;
+        m_begin = 0;
+    }
+    if (m_end == m_buffer.size()) {
+        // a single line is bigger than the buffer
+        m_buffer.resize(m_buffer.size() * 2);
+    }
+
+    if (m_decompressor) {
+        const auto amount{ this->readDecompressed(m_buffer.data() + m_end, m_buffer.size() - m_end) };
+        m_end += amount;
+        return amount != 0;
+    }
+
+    while (true) {
+        const auto amount{ ::read(m_fd, m_buffer.data() + m_end, m_buffer.size() - m_end) };
+        if (amount == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw ::std::system_error{ errno, ::std::generic_category(), "read" };
+        }
+        m_end += static_cast<::std::size_t>(amount);
+        return amount != 0;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::LineReader::readDecompressed(
+    char* data
+    , ::std::size_t size
+) -> ::std::size_t
+{
+    ::std::size_t total{ 0 };
+    while (total < size) {
+        if (m_decompressed.empty()) {
+            if (!m_decompressor->next()) {
+                break;
+            }
+            m_decompressed = m_decompressor->getChunk();
+        }
+        const auto amount{ ::std::min(size - total, m_decompressed.size()) };
+        ::std::memcpy(data + total, m_decompressed.data(), amount);
+        m_decompressed.remove_prefix(amount);
+        total += amount;
+    }
+    return total;
+}
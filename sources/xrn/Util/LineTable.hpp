@@ -0,0 +1,376 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <fcntl.h>
+#include <xrn/Util/AlignedBuffer.hpp>
+#include <xrn/Util/ByteScanner.hpp>
+#include <xrn/Util/FileDescriptor.hpp>
+#include <xrn/Util/MappedFile.hpp>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Random access table of the lines of a file
+/// \ingroup util
+///
+/// \include LineTable.hpp <xrn/Util/LineTable.hpp>
+///
+/// ::xrn::util::BasicLineTable loads a whole file into one contiguous buffer
+/// and indexes the start of every line in a compact offset array of the type
+/// given as template parameter. Compared to a
+/// ::std::vector<::std::string>, it costs two allocations whatever the amount
+/// of lines and keeps them adjacent in memory.
+/// Lines are accessed as ::std::string_view, without the trailing "\n" or
+/// "\r\n", and stay valid as long as the table is alive. Another delimiter
+/// byte can be given to index records instead of lines, in which case no
+/// '\r' is removed.
+/// A table can also be built over a ::xrn::util::MappedFile, in which case
+/// the content is not copied and the file is split in byte ranges indexed on
+/// several threads before their offsets are stitched together.
+/// ::xrn::util::LineTable and ::xrn::LineTable are aliases of
+/// ::xrn::util::BasicLineTable<::std::uint64_t>. Using ::std::uint32_t
+/// halves the size of the index for files smaller than 4GiB.
+///
+/// Usage example:
+/// \code
+/// auto table{ ::xrn::File::getLineTable("filepath") };
+/// auto bigTable{ ::xrn::File::getLineTable("bigFilepath", 8) }; // 8 threads
+/// ::std::string_view line{ table[42] };
+/// for (auto line : table) { ... }
+/// \endcode
+///
+/// \see ::xrn::util::File
+///
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> class BasicLineTable {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Type of the offsets stored in the index
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Type = T;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Minimal amount of bytes indexed by a thread
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static constexpr ::std::size_t minBytesPerThread{ 1024 * 1024 };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Random access iterator over the lines
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    class Iterator {
+
+    public:
+
+        using value_type = ::std::string_view;
+        using difference_type = ::std::ptrdiff_t;
+        using iterator_concept = ::std::random_access_iterator_tag;
+
+        Iterator() noexcept = default;
+
+        explicit constexpr Iterator(
+            const BasicLineTable& table
+            , ::std::size_t index
+        ) noexcept;
+
+        [[ nodiscard ]] constexpr auto operator*() const noexcept
+            -> ::std::string_view;
+
+        [[ nodiscard ]] constexpr auto operator[](
+            difference_type offset
+        ) const noexcept
+            -> ::std::string_view;
+
+        constexpr auto operator++() noexcept
+            -> Iterator&;
+
+        constexpr auto operator++(
+            int
+        ) noexcept
+            -> Iterator;
+
+        constexpr auto operator--() noexcept
+            -> Iterator&;
+
+        constexpr auto operator--(
+            int
+        ) noexcept
+            -> Iterator;
+
+        constexpr auto operator+=(
+            difference_type offset
+        ) noexcept
+            -> Iterator&;
+
+        constexpr auto operator-=(
+            difference_type offset
+        ) noexcept
+            -> Iterator&;
+
+        [[ nodiscard ]] constexpr auto operator+(
+            difference_type offset
+        ) const noexcept
+            -> Iterator;
+
+        [[ nodiscard ]] friend constexpr auto operator+(
+            difference_type offset
+            , const Iterator& it
+        ) noexcept
+            -> Iterator
+        {
+            return it + offset;
+        }
+
+        [[ nodiscard ]] constexpr auto operator-(
+            difference_type offset
+        ) const noexcept
+            -> Iterator;
+
+        [[ nodiscard ]] constexpr auto operator-(
+            const Iterator& rhs
+        ) const noexcept
+            -> difference_type;
+
+        [[ nodiscard ]] constexpr auto operator==(
+            const Iterator& rhs
+        ) const noexcept
+            -> bool;
+
+        [[ nodiscard ]] constexpr auto operator<=>(
+            const Iterator& rhs
+        ) const noexcept
+            -> ::std::strong_ordering;
+
+    private:
+
+        const BasicLineTable* m_table{ nullptr };
+
+        ::std::size_t m_index{ 0 };
+
+    };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructs an empty table
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit BasicLineTable() noexcept = default;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Loads and indexes a whole file
+    ///
+    /// \param filename Path of the file to load
+    /// \param delimiter Byte separating two lines
+    ///
+    /// \throws ::std::system_error if the file cannot be read
+    /// \throws ::std::length_error if the file is too big to be indexed with
+    ///         ::xrn::util::BasicLineTable::Type
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit BasicLineTable(
+        const ::std::string& filename
+        , char delimiter = '\n'
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Indexes a mapped file on multiple threads
+    ///
+    /// The mapping is owned by the table, the content is not copied.
+    ///
+    /// \param mapping File to index
+    /// \param delimiter Byte separating two lines
+    /// \param threadCount Amount of threads used to index, 0 uses one thread
+    ///        per hardware thread
+    ///
+    /// \throws ::std::length_error if the file is too big to be indexed with
+    ///         ::xrn::util::BasicLineTable::Type
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit BasicLineTable(
+        ::xrn::util::MappedFile mapping
+        , char delimiter = '\n'
+        , ::std::size_t threadCount = 0
+    );
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Line at the given index, without bound checking
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto operator[](
+        ::std::size_t index
+    ) const noexcept
+        -> ::std::string_view;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Line at the given index
+    ///
+    /// \throws ::std::out_of_range if index >= size()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto getLine(
+        ::std::size_t index
+    ) const
+        -> ::std::string_view;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of lines
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto size() const noexcept
+        -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the table contains no lines
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto empty() const noexcept
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whole content of the file
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto getContent() const noexcept
+        -> ::std::string_view;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Offset of the start of every line, followed by a sentinel
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto getOffsets() const noexcept
+        -> ::std::span<const BasicLineTable::Type>;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Range
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Iterator to the first line
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto begin() const noexcept
+        -> BasicLineTable::Iterator;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Iterator past the last line
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto end() const noexcept
+        -> BasicLineTable::Iterator;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Fills m_offsets from m_content
+    ///
+    /// Small contents are always indexed on the calling thread.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    void index(
+        ::std::size_t threadCount = 1
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Throws if a content of this size cannot be indexed
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void checkSize(
+        ::std::size_t size
+        , const ::std::string& filename
+    );
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Storage of the content, either read in a buffer or mapped
+    ///////////////////////////////////////////////////////////////////////////
+    ::xrn::util::AlignedBuffer m_buffer;
+    ::xrn::util::MappedFile m_mapping;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Whole content of the file
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::string_view m_content;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Start of every line followed by a sentinel placed one byte after the
+    // delimiter ending the last line (real or not), line i is therefore
+    // [m_offsets[i], m_offsets[i + 1] - 1)
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::vector<BasicLineTable::Type> m_offsets;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Byte separating two lines
+    ///////////////////////////////////////////////////////////////////////////
+    char m_delimiter{ '\n' };
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn::util { using LineTable = ::xrn::util::BasicLineTable<::std::uint64_t>; }
+namespace xrn { using LineTable = ::xrn::util::LineTable; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/LineTable.impl.hpp>
@@ -0,0 +1,407 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Iterator
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr ::xrn::util::BasicLineTable<T>::Iterator::Iterator(
+    const BasicLineTable& table
+    , ::std::size_t index
+) noexcept
+    : m_table{ &table }
+    , m_index{ index }
+{}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::Iterator::operator*() const noexcept
+    -> ::std::string_view
+{
+    return (*m_table)[m_index];
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::Iterator::operator[](
+    difference_type offset
+) const noexcept
+    -> ::std::string_view
+{
+    return (*m_table)[static_cast<::std::size_t>(static_cast<difference_type>(m_index) + offset)];
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::Iterator::operator++() noexcept
+    -> Iterator&
+{
+    ++m_index;
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::Iterator::operator++(
+    int
+) noexcept
+    -> Iterator
+{
+    auto copy{ *this };
+    ++m_index;
+    return copy;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::Iterator::operator--() noexcept
+    -> Iterator&
+{
+    --m_index;
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::Iterator::operator--(
+    int
+) noexcept
+    -> Iterator
+{
+    auto copy{ *this };
+    --m_index;
+    return copy;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::Iterator::operator+=(
+    difference_type offset
+) noexcept
+    -> Iterator&
+{
+    m_index = static_cast<::std::size_t>(static_cast<difference_type>(m_index) + offset);
+    return *this;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::Iterator::operator-=(
+    difference_type offset
+) noexcept
+    -> Iterator&
+{
+    return *this += -offset;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::Iterator::operator+(
+    difference_type offset
+) const noexcept
+    -> Iterator
+{
+    auto copy{ *this };
+    return copy += offset;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::Iterator::operator-(
+    difference_type offset
+) const noexcept
+    -> Iterator
+{
+    auto copy{ *this };
+    return copy -= offset;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::Iterator::operator-(
+    const Iterator& rhs
+) const noexcept
+    -> difference_type
+{
+    return static_cast<difference_type>(m_index) - static_cast<difference_type>(rhs.m_index);
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::Iterator::operator==(
+    const Iterator& rhs
+) const noexcept
+    -> bool
+{
+    return m_index == rhs.m_index;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::Iterator::operator<=>(
+    const Iterator& rhs
+) const noexcept
+    -> ::std::strong_ordering
+{
+    return m_index <=> rhs.m_index;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> ::xrn::util::BasicLineTable<T>::BasicLineTable(
+    const ::std::string& filename
+    , char delimiter
+)
+    : m_delimiter{ delimiter }
+{
+    ::xrn::util::FileDescriptor file{ filename, O_RDONLY };
+    BasicLineTable::checkSize(file.getSize(), filename);
+    file.readAll(m_buffer);
+    m_content = m_buffer.getView();
+    // files reporting a size of 0 (procfs, pipes, ...) are only measured here
+    BasicLineTable::checkSize(m_content.size(), filename);
+
+    this->index();
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> ::xrn::util::BasicLineTable<T>::BasicLineTable(
+    ::xrn::util::MappedFile mapping
+    , char delimiter
+    , ::std::size_t threadCount
+)
+    : m_mapping{ ::std::move(mapping) }
+    , m_content{ m_mapping.getView() }
+    , m_delimiter{ delimiter }
+{
+    BasicLineTable::checkSize(m_content.size(), "mapped file");
+    if (threadCount == 0) {
+        threadCount = ::std::max(::std::thread::hardware_concurrency(), 1u);
+    }
+    this->index(threadCount);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Getters
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::operator[](
+    ::std::size_t index
+) const noexcept
+    -> ::std::string_view
+{
+    const auto begin{ static_cast<::std::size_t>(m_offsets[index]) };
+    const auto end{ static_cast<::std::size_t>(m_offsets[index + 1]) - 1 };
+    const auto line{ m_content.substr(begin, end - begin) };
+    return (m_delimiter == '\n') ? ::xrn::util::ByteScanner::trimCarriageReturn(line) : line;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::getLine(
+    ::std::size_t index
+) const
+    -> ::std::string_view
+{
+    if (index >= this->size()) {
+        throw ::std::out_of_range{ "line table index out of range" };
+    }
+    return (*this)[index];
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::size() const noexcept
+    -> ::std::size_t
+{
+    return m_offsets.empty() ? 0 : m_offsets.size() - 1;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::empty() const noexcept
+    -> bool
+{
+    return this->size() == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::getContent() const noexcept
+    -> ::std::string_view
+{
+    return m_content;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::getOffsets() const noexcept
+    -> ::std::span<const BasicLineTable::Type>
+{
+    return m_offsets;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Range
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::begin() const noexcept
+    -> BasicLineTable::Iterator
+{
+    return BasicLineTable::Iterator{ *this, 0 };
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> constexpr auto ::xrn::util::BasicLineTable<T>::end() const noexcept
+    -> BasicLineTable::Iterator
+{
+    return BasicLineTable::Iterator{ *this, this->size() };
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> void ::xrn::util::BasicLineTable<T>::index(
+    ::std::size_t threadCount
+)
+{
+    m_offsets.clear();
+    if (m_content.empty()) {
+        return;
+    }
+
+    const char* const first{ m_content.data() };
+    const char* const last{ first + m_content.size() };
+    threadCount = ::std::clamp(m_content.size() / BasicLineTable::minBytesPerThread, 1uz, threadCount);
+
+    if (threadCount == 1) {
+        m_offsets.reserve(::xrn::util::ByteScanner::count(first, last, m_delimiter) + 2);
+        m_offsets.push_back(0);
+        ::xrn::util::ByteScanner::forEach(first, last, m_delimiter, [this, first](const char* it){
+            m_offsets.push_back(static_cast<BasicLineTable::Type>(it - first + 1));
+        });
+    } else {
+        // each thread indexes its own byte range, the ranges being contiguous
+        // and ordered their tables only have to be concatenated
+        const auto chunkSize{ m_content.size() / threadCount };
+        ::std::vector<::std::future<::std::vector<BasicLineTable::Type>>> chunks;
+        chunks.reserve(threadCount);
+        for (auto i{ 0uz }; i < threadCount; ++i) {
+            const char* const chunkFirst{ first + i * chunkSize };
+            const char* const chunkLast{ (i + 1 == threadCount) ? last : chunkFirst + chunkSize };
+            chunks.push_back(::std::async(::std::launch::async, [this, first, chunkFirst, chunkLast]{
+                ::std::vector<BasicLineTable::Type> offsets;
+                offsets.reserve(static_cast<::std::size_t>(chunkLast - chunkFirst) / 64);
+                ::xrn::util::ByteScanner::forEach(chunkFirst, chunkLast, m_delimiter, [&offsets, first](const char* it){
+                    offsets.push_back(static_cast<BasicLineTable::Type>(it - first + 1));
+                });
+                return offsets;
+            }));
+        }
+
+        ::std::vector<::std::vector<BasicLineTable::Type>> tables;
+        tables.reserve(threadCount);
+        ::std::size_t total{ 1 };
+        for (auto& chunk : chunks) {
+            tables.push_back(chunk.get());
+            total += tables.back().size();
+        }
+
+        m_offsets.reserve(total + 1); // room for the sentinel
+        m_offsets.resize(total);
+        m_offsets[0] = 0;
+        auto* destination{ m_offsets.data() + 1 };
+        ::std::vector<::std::future<void>> copies;
+        copies.reserve(threadCount);
+        for (auto& table : tables) {
+            copies.push_back(::std::async(::std::launch::async, [&table, destination]{
+                ::std::ranges::copy(table, destination);
+            }));
+            destination += table.size();
+        }
+        for (auto& copy : copies) {
+            copy.get();
+        }
+    }
+
+    // pretend the last line is terminated by a delimiter if it is not
+    if (m_offsets.back() != m_content.size()) {
+        m_offsets.push_back(static_cast<BasicLineTable::Type>(m_content.size() + 1));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::unsigned_integral T
+> void ::xrn::util::BasicLineTable<T>::checkSize(
+    ::std::size_t size
+    , const ::std::string& filename
+)
+{
+    // the sentinel may be placed one byte past the end of the content
+    if (size >= ::std::numeric_limits<BasicLineTable::Type>::max()) {
+        throw ::std::length_error{ filename + ": too big for the offset type of the line table" };
+    }
+}
@@ -0,0 +1,294 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Read-only memory mapped view of a file
+/// \ingroup util
+///
+/// \include MappedFile.hpp <xrn/Util/MappedFile.hpp>
+///
+/// ::xrn::util::MappedFile owns a read-only mmap of a whole file and unmaps
+/// it when destroyed. The content is accessed without any copy through
+/// getView() or getBytes(). Hints can be given to the kernel through
+/// ::xrn::util::MappedFile::Advice to speed up sequential or large reads.
+/// The class is move-only and is usually created by ::xrn::util::File::map().
+///
+/// Usage example:
+/// \code
+/// using Advice = ::xrn::util::MappedFile::Advice;
+/// auto mapped{ ::xrn::File::map("filepath", Advice::sequential | Advice::willNeed) };
+/// ::std::string_view content{ mapped.getView() };
+/// \endcode
+///
+/// \see ::xrn::util::File
+///
+///////////////////////////////////////////////////////////////////////////
+class MappedFile {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Access pattern hints forwarded to madvise()
+    ///
+    /// Values can be combined with operator|.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    enum class Advice : ::std::uint8_t {
+        normal = 0,
+        sequential = 1 << 0,
+        random = 1 << 1,
+        willNeed = 1 << 2,
+        hugePage = 1 << 3,
+    };
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructs an empty mapping
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit MappedFile() noexcept = default;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Maps the whole file in read-only mode
+    ///
+    /// Empty files are valid and produce an empty view without any mapping.
+    ///
+    /// \param filename Path of the file to map
+    /// \param advice Hints given to the kernel about the access pattern
+    ///
+    /// \throws ::std::system_error if the file cannot be opened or mapped
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit inline MappedFile(
+        const ::std::string& filename
+        , MappedFile::Advice advice = MappedFile::Advice::normal
+    );
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Rule of 5
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Unmaps the file.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline ~MappedFile();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy constructor deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    MappedFile(
+        const MappedFile& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy assign operator deleted
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        const MappedFile& that
+    ) noexcept
+        -> MappedFile& = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline MappedFile(
+        MappedFile&& that
+    ) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move assign operator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline auto operator=(
+        MappedFile&& that
+    ) noexcept
+        -> MappedFile&;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Gives new access pattern hints for the whole mapping
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void advise(
+        MappedFile::Advice advice
+    ) const noexcept;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Content of the file as characters
+    ///
+    /// The view is valid as long as the ::xrn::util::MappedFile is alive.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getView() const noexcept
+        -> ::std::string_view;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Content of the file as bytes
+    ///
+    /// The span is valid as long as the ::xrn::util::MappedFile is alive.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto getBytes() const noexcept
+        -> ::std::span<const ::std::byte>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Pointer to the first character of the mapping
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto data() const noexcept
+        -> const char*;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Size of the mapping in bytes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto size() const noexcept
+        -> ::std::size_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the mapping contains no bytes
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline auto empty() const noexcept
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Alias method of getView()
+    ///
+    /// \see getView()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] inline operator ::std::string_view() const noexcept;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Releases the mapping if any
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    inline void unmap() noexcept;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Start of the mapping, nullptr if empty
+    ///////////////////////////////////////////////////////////////////////////
+    void* m_data{ nullptr };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Size of the mapping in bytes
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::size_t m_size{ 0 };
+
+};
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Combines two ::xrn::util::MappedFile::Advice
+///
+///////////////////////////////////////////////////////////////////////////
+[[ nodiscard ]] constexpr auto operator|(
+    MappedFile::Advice lhs
+    , MappedFile::Advice rhs
+) noexcept
+    -> MappedFile::Advice
+{
+    return static_cast<MappedFile::Advice>(
+        static_cast<::std::uint8_t>(lhs) | static_cast<::std::uint8_t>(rhs)
+    );
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Checks whether \a rhs is set in \a lhs
+///
+///////////////////////////////////////////////////////////////////////////
+[[ nodiscard ]] constexpr auto operator&(
+    MappedFile::Advice lhs
+    , MappedFile::Advice rhs
+) noexcept
+    -> bool
+{
+    return static_cast<::std::uint8_t>(lhs) & static_cast<::std::uint8_t>(rhs);
+}
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { using MappedFile = ::xrn::util::MappedFile; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/MappedFile.impl.hpp>
@@ -0,0 +1,185 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::MappedFile::MappedFile(
+    const ::std::string& filename
+    , MappedFile::Advice advice
+)
+{
+    const int fd{ ::open(filename.c_str(), O_RDONLY | O_CLOEXEC) };
+    if (fd == -1) {
+        throw ::std::system_error{ errno, ::std::generic_category(), filename };
+    }
+
+    struct ::stat status;
+    if (::fstat(fd, &status) == -1) {
+        const int error{ errno };
+        ::close(fd);
+        throw ::std::system_error{ error, ::std::generic_category(), filename };
+    }
+
+    m_size = static_cast<::std::size_t>(status.st_size);
+    if (m_size == 0) {
+        ::close(fd);
+        return;
+    }
+
+    void* data{ ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0) };
+    const int error{ errno };
+    ::close(fd); // the mapping keeps its own reference to the file
+    if (data == MAP_FAILED) {
+        m_size = 0;
+        throw ::std::system_error{ error, ::std::generic_category(), filename };
+    }
+    m_data = data;
+
+    this->advise(advice);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Rule of 5
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::MappedFile::~MappedFile()
+{
+    this->unmap();
+}
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::MappedFile::MappedFile(
+    MappedFile&& that
+) noexcept
+    : m_data{ ::std::exchange(that.m_data, nullptr) }
+    , m_size{ ::std::exchange(that.m_size, 0) }
+{}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::MappedFile::operator=(
+    MappedFile&& that
+) noexcept
+    -> MappedFile&
+{
+    if (this != &that) {
+        this->unmap();
+        m_data = ::std::exchange(that.m_data, nullptr);
+        m_size = ::std::exchange(that.m_size, 0);
+    }
+    return *this;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::MappedFile::advise(
+    MappedFile::Advice advice
+) const noexcept
+{
+    if (!m_data) {
+        return;
+    }
+
+    // hints are best effort, failures are not reported
+    if (advice & MappedFile::Advice::sequential) {
+        ::madvise(m_data, m_size, MADV_SEQUENTIAL);
+    }
+    if (advice & MappedFile::Advice::random) {
+        ::madvise(m_data, m_size, MADV_RANDOM);
+    }
+    if (advice & MappedFile::Advice::willNeed) {
+        ::madvise(m_data, m_size, MADV_WILLNEED);
+    }
+#ifdef MADV_HUGEPAGE
+    if (advice & MappedFile::Advice::hugePage) {
+        ::madvise(m_data, m_size, MADV_HUGEPAGE);
+    }
+#endif // MADV_HUGEPAGE
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Getters
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::MappedFile::getView() const noexcept
+    -> ::std::string_view
+{
+    return ::std::string_view{ this->data(), m_size };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::MappedFile::getBytes() const noexcept
+    -> ::std::span<const ::std::byte>
+{
+    return ::std::span<const ::std::byte>{ static_cast<const ::std::byte*>(m_data), m_size };
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::MappedFile::data() const noexcept
+    -> const char*
+{
+    return static_cast<const char*>(m_data);
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::MappedFile::size() const noexcept
+    -> ::std::size_t
+{
+    return m_size;
+}
+
+///////////////////////////////////////////////////////////////////////////
+auto ::xrn::util::MappedFile::empty() const noexcept
+    -> bool
+{
+    return m_size == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////
+::xrn::util::MappedFile::operator ::std::string_view() const noexcept
+{
+    return this->getView();
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+void ::xrn::util::MappedFile::unmap() noexcept
+{
+    if (m_data) {
+        ::munmap(m_data, m_size);
+        m_data = nullptr;
+        m_size = 0;
+    }
+}
@@ -0,0 +1,340 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/Clock.hpp>
+#include <xrn/Util/TimerStats.hpp>
+
+
+
+namespace xrn::util::detail {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief String literal usable as template parameter
+///
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::size_t size
+> struct FixedString {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copies the literal, null terminator included
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr FixedString(
+        const char (&string)[size]
+    ) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief View of the string, without its null terminator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto getView() const noexcept
+        -> ::std::string_view;
+
+    // public so the type is structural
+    char value[size];
+
+};
+
+} // namespace xrn::util::detail
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Records the duration of a scope into named statistics
+/// \ingroup util
+///
+/// \include ScopedTimer.hpp <xrn/Util/ScopedTimer.hpp>
+///
+/// ::xrn::util::ScopedTimer starts a clock when constructed and, when
+/// destroyed, records the elapsed time into the statistics slot named by
+/// the string literal given as template parameter.
+/// Each name is a distinct type, so the slots are registered at compile
+/// time: there is no lookup by name when recording. Every thread records
+/// into its own accumulator without any lock nor read-modify-write
+/// operation, getSnapshot() merges the accumulators of all the threads
+/// (and of the threads already finished) on demand.
+///
+/// Usage example:
+/// \code
+/// void update()
+/// {
+///     ::xrn::ScopedTimer<"update"> timer;
+///     ...
+/// }
+///
+/// auto stats{ ::xrn::ScopedTimer<"update">::getSnapshot() };
+/// auto mean{ stats.getMean() };
+/// \endcode
+///
+/// \see ::xrn::util::TimerStats, ::xrn::util::BasicClock
+///
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::xrn::util::detail::FixedString name
+    , typename ClockType = ::xrn::util::Clock
+> class ScopedTimer {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Clock measuring the scope
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Clock = ClockType;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Statistics of the slot, in the unit of the clock
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Stats = ::xrn::util::TimerStats<
+        ::xrn::util::BasicTime<double, typename ClockType::Type::Period>
+    >;
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// Starts measuring.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    explicit ScopedTimer() noexcept;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Rule of 5
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Records the time elapsed since the construction.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ~ScopedTimer();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ScopedTimer(
+        const ScopedTimer& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Copy assign operator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        const ScopedTimer& that
+    ) noexcept
+        -> ScopedTimer& = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    ScopedTimer(
+        ScopedTimer&& that
+    ) noexcept = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Move assign operator
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    auto operator=(
+        ScopedTimer&& that
+    ) noexcept
+        -> ScopedTimer& = delete;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Time elapsed since the construction
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] auto getElapsed()
+        -> typename ScopedTimer::Clock::Type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Records a duration measured by other means into the slot
+    ///
+    /// \param duration ::xrn::util::BasicTime or ::std::chrono::duration,
+    ///                 a raw value is in the unit of the clock
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    static void record(
+        const auto& duration
+    );
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Merges the statistics recorded by every thread
+    ///
+    /// The statistics of each thread are read without blocking it, a thread
+    /// recording at the same time is only waited for the few stores of its
+    /// current record.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static auto getSnapshot()
+        -> ScopedTimer::Stats;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Name of the slot
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static constexpr auto getName() noexcept
+        -> ::std::string_view;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Statistics of a thread, written by its thread only and published with
+    // a sequence lock: the sequence is odd while the words are written
+    ///////////////////////////////////////////////////////////////////////////
+    class Accumulator {
+
+    public:
+
+        explicit Accumulator();
+
+        ~Accumulator();
+
+        Accumulator(
+            const Accumulator& that
+        ) noexcept = delete;
+
+        auto operator=(
+            const Accumulator& that
+        ) noexcept
+            -> Accumulator& = delete;
+
+        Accumulator(
+            Accumulator&& that
+        ) noexcept = delete;
+
+        auto operator=(
+            Accumulator&& that
+        ) noexcept
+            -> Accumulator& = delete;
+
+        void record(
+            const typename ScopedTimer::Stats::Time& duration
+        ) noexcept;
+
+        [[ nodiscard ]] auto load() const noexcept
+            -> ScopedTimer::Stats;
+
+    private:
+
+        static_assert(::std::is_trivially_copyable_v<typename ScopedTimer::Stats>);
+        static_assert(sizeof(typename ScopedTimer::Stats) % sizeof(::std::uint64_t) == 0);
+        static constexpr ::std::size_t wordCount{
+            sizeof(typename ScopedTimer::Stats) / sizeof(::std::uint64_t)
+        };
+
+        typename ScopedTimer::Stats m_stats;
+        ::std::atomic<::std::uint64_t> m_sequence{ 0 };
+        ::std::array<::std::atomic<::std::uint64_t>, wordCount> m_words{};
+
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Accumulators of the running threads, and the merged statistics of the
+    // finished ones
+    ///////////////////////////////////////////////////////////////////////////
+    struct Registry {
+        ::std::mutex mutex;
+        ::std::vector<const ScopedTimer::Accumulator*> accumulators;
+        typename ScopedTimer::Stats retired;
+    };
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static auto getRegistry()
+        -> ScopedTimer::Registry&;
+
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static auto getAccumulator()
+        -> ScopedTimer::Accumulator&;
+
+
+
+private:
+
+    ScopedTimer::Clock m_clock;
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn {
+    template <
+        ::xrn::util::detail::FixedString name
+        , typename ClockType = ::xrn::util::Clock
+    > using ScopedTimer = ::xrn::util::ScopedTimer<name, ClockType>;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/ScopedTimer.impl.hpp>
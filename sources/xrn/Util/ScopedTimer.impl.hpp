@@ -0,0 +1,235 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// FixedString
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::size_t size
+> constexpr ::xrn::util::detail::FixedString<size>::FixedString(
+    const char (&string)[size]
+) noexcept
+{
+    ::std::copy_n(string, size, value);
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::std::size_t size
+> constexpr auto ::xrn::util::detail::FixedString<size>::getView() const noexcept
+    -> ::std::string_view
+{
+    return ::std::string_view{ value, size - 1 };
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Accumulator
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::xrn::util::detail::FixedString name
+    , typename ClockType
+> ::xrn::util::ScopedTimer<name, ClockType>::Accumulator::Accumulator()
+{
+    auto& registry{ ScopedTimer::getRegistry() };
+    ::std::scoped_lock lock{ registry.mutex };
+    registry.accumulators.push_back(this);
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::xrn::util::detail::FixedString name
+    , typename ClockType
+> ::xrn::util::ScopedTimer<name, ClockType>::Accumulator::~Accumulator()
+{
+    // the thread is over, what it recorded is kept in the registry
+    auto& registry{ ScopedTimer::getRegistry() };
+    ::std::scoped_lock lock{ registry.mutex };
+    registry.retired.merge(m_stats);
+    ::std::erase(registry.accumulators, this);
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::xrn::util::detail::FixedString name
+    , typename ClockType
+> void ::xrn::util::ScopedTimer<name, ClockType>::Accumulator::record(
+    const typename ScopedTimer::Stats::Time& duration
+) noexcept
+{
+    m_stats.record(duration);
+
+    // only this thread writes, plain stores are enough
+    const auto sequence{ m_sequence.load(::std::memory_order::relaxed) };
+    m_sequence.store(sequence + 1, ::std::memory_order::relaxed);
+    ::std::atomic_thread_fence(::std::memory_order::release);
+    const auto words{ ::std::bit_cast<::std::array<::std::uint64_t, wordCount>>(m_stats) };
+    for (auto i{ 0uz }; i < wordCount; ++i) {
+        m_words[i].store(words[i], ::std::memory_order::relaxed);
+    }
+    m_sequence.store(sequence + 2, ::std::memory_order::release);
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::xrn::util::detail::FixedString name
+    , typename ClockType
+> auto ::xrn::util::ScopedTimer<name, ClockType>::Accumulator::load() const noexcept
+    -> ScopedTimer::Stats
+{
+    ::std::array<::std::uint64_t, wordCount> words;
+    while (true) {
+        const auto sequence{ m_sequence.load(::std::memory_order::acquire) };
+        if (sequence & 1) {
+            ::std::this_thread::yield();
+            continue;
+        }
+        for (auto i{ 0uz }; i < wordCount; ++i) {
+            words[i] = m_words[i].load(::std::memory_order::relaxed);
+        }
+        ::std::atomic_thread_fence(::std::memory_order::acquire);
+        if (m_sequence.load(::std::memory_order::relaxed) == sequence) {
+            return ::std::bit_cast<typename ScopedTimer::Stats>(words);
+        }
+    }
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Constructors
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::xrn::util::detail::FixedString name
+    , typename ClockType
+> ::xrn::util::ScopedTimer<name, ClockType>::ScopedTimer() noexcept = default;
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Rule of 5
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::xrn::util::detail::FixedString name
+    , typename ClockType
+> ::xrn::util::ScopedTimer<name, ClockType>::~ScopedTimer()
+{
+    ScopedTimer::record(m_clock.getElapsed());
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::xrn::util::detail::FixedString name
+    , typename ClockType
+> auto ::xrn::util::ScopedTimer<name, ClockType>::getElapsed()
+    -> typename ScopedTimer::Clock::Type
+{
+    return m_clock.getElapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::xrn::util::detail::FixedString name
+    , typename ClockType
+> void ::xrn::util::ScopedTimer<name, ClockType>::record(
+    const auto& duration
+)
+{
+    ScopedTimer::getAccumulator().record(typename ScopedTimer::Stats::Time{ duration });
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::xrn::util::detail::FixedString name
+    , typename ClockType
+> auto ::xrn::util::ScopedTimer<name, ClockType>::getSnapshot()
+    -> ScopedTimer::Stats
+{
+    auto& registry{ ScopedTimer::getRegistry() };
+    ::std::scoped_lock lock{ registry.mutex };
+    auto stats{ registry.retired };
+    for (const auto* accumulator : registry.accumulators) {
+        stats.merge(accumulator->load());
+    }
+    return stats;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Getters
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::xrn::util::detail::FixedString name
+    , typename ClockType
+> constexpr auto ::xrn::util::ScopedTimer<name, ClockType>::getName() noexcept
+    -> ::std::string_view
+{
+    return name.getView();
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::xrn::util::detail::FixedString name
+    , typename ClockType
+> auto ::xrn::util::ScopedTimer<name, ClockType>::getRegistry()
+    -> ScopedTimer::Registry&
+{
+    static ScopedTimer::Registry registry;
+    return registry;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    ::xrn::util::detail::FixedString name
+    , typename ClockType
+> auto ::xrn::util::ScopedTimer<name, ClockType>::getAccumulator()
+    -> ScopedTimer::Accumulator&
+{
+    // constructed after the registry, so destroyed before it
+    static thread_local ScopedTimer::Accumulator accumulator;
+    return accumulator;
+}
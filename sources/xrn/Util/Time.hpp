@@ -20,7 +20,16 @@ namespace xrn::util {
 /// template parameter.
 /// This class is mostly used by ::xrn::util::BasicClock, but can be used
 /// manually.
-/// This class is aliased with ::xrn::util::Time and ::xrn::Time.
+/// The unit of the stored value is Unit, a ::std::ratio of a second like
+/// the period of ::std::chrono::duration, milliseconds by default.
+/// ::xrn::util::NanoTime counts integral nanoseconds, so every computation
+/// stays exact however long the uptime. Raw values given to the
+/// methods are in that unit, ::xrn::util::BasicTime of another type or unit
+/// and ::std::chrono::duration are converted. The conversion factors are
+/// computed at compile time: a conversion is a single multiplication (or an
+/// integer division by a constant), and none at all between equal units.
+/// This class is aliased with ::xrn::util::Time and ::xrn::Time, the integral
+/// nanoseconds variant with ::xrn::util::NanoTime and ::xrn::NanoTime.
 ///
 /// Usage example:
 /// \code
@@ -44,6 +53,7 @@ namespace xrn::util {
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
+    , typename Unit = ::std::milli
 > class BasicTime {
 
 public:
@@ -61,6 +71,12 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     using Type = T;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Unit of the value internally stored, as a fraction of second
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Period = Unit;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Constructs a ::xrn::util::BasicTime from a value evaluated as
     ///        seconds
@@ -122,6 +138,22 @@ public:
         const auto& amount
     ) noexcept -> BasicTime;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Constructs a ::xrn::util::BasicTime from a value evaluated in
+    ///        any unit
+    ///
+    /// \tparam FromUnit Unit of amount as a ::std::ratio of a second, such as
+    ///         ::std::ratio<60> for minutes
+    ///
+    /// \see createAsSeconds(), createAsMilliseconds()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <
+        typename FromUnit
+    > [[ nodiscard ]] constexpr static auto createAs(
+        const auto& amount
+    ) noexcept -> BasicTime;
+
 
 
 public:
@@ -147,7 +179,8 @@ public:
     ///
     /// Constructs a ::xrn::util::BasicTime containing a point in time.
     ///
-    /// \param amount Time in milliseconds
+    /// \param amount Time in Period units, or a ::xrn::util::BasicTime of
+    ///        another type converted to Period
     ///
     ///////////////////////////////////////////////////////////////////////////
     explicit constexpr BasicTime(
@@ -181,6 +214,25 @@ public:
     ) const
         -> ::std::partial_ordering;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Equality with a ::xrn::util::BasicTime values
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto operator==(
+        const BasicTime& rhs
+    ) const
+        -> bool;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Equality with any type if comparable with the internal type,
+    ///        times of other units are converted first
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto operator==(
+        const auto& rhs
+    ) const
+        -> bool;
+
 
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -267,6 +319,20 @@ public:
     [[ nodiscard ]] constexpr auto getAsNanoseconds() const
         -> BasicTime::Type;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Get the value in any unit
+    ///
+    /// \tparam ToUnit Unit as a ::std::ratio of a second, such as
+    ///         ::std::ratio<60> for minutes
+    ///
+    /// \see getAsSeconds(), getAsMilliseconds()
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <
+        typename ToUnit
+    > [[ nodiscard ]] constexpr auto getAs() const
+        -> BasicTime::Type;
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Get the value as seconds
     ///
@@ -334,7 +400,7 @@ public:
     /// \see set()
     ///
     ///////////////////////////////////////////////////////////////////////////
-    auto operator=(
+    constexpr auto operator=(
         const auto& amount
     ) -> BasicTime&;
 
@@ -346,7 +412,7 @@ public:
     /// \see operator=()
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void set(
+    constexpr void set(
         const BasicTime& amount
     );
 
@@ -358,7 +424,7 @@ public:
     /// \see operator=()
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void set(
+    constexpr void set(
         const auto& amount
     );
 
@@ -379,7 +445,7 @@ public:
     /// \return New time added with \a rhs
     ///
     ///////////////////////////////////////////////////////////////////////////
-    auto operator+=(
+    constexpr auto operator+=(
         const BasicTime& rhs
     ) -> BasicTime&;
 
@@ -391,7 +457,7 @@ public:
     /// \return New time added with \a rhs
     ///
     ///////////////////////////////////////////////////////////////////////////
-    auto operator+=(
+    constexpr auto operator+=(
         const auto& rhs
     ) -> BasicTime&;
 
@@ -439,7 +505,7 @@ public:
     /// \return New time added with \a rhs
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void add(
+    constexpr void add(
         const BasicTime& amount
     );
 
@@ -453,7 +519,7 @@ public:
     /// \return New time added with \a rhs
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void add(
+    constexpr void add(
         const auto& amount
     );
 
@@ -474,7 +540,7 @@ public:
     /// \return New time added with \a rhs
     ///
     ///////////////////////////////////////////////////////////////////////////
-    auto operator-=(
+    constexpr auto operator-=(
         const BasicTime& rhs
     ) -> BasicTime&;
 
@@ -486,7 +552,7 @@ public:
     /// \return New time added with \a rhs
     ///
     ///////////////////////////////////////////////////////////////////////////
-    auto operator-=(
+    constexpr auto operator-=(
         const auto& rhs
     ) -> BasicTime&;
 
@@ -534,7 +600,7 @@ public:
     /// \return New time added with \a rhs
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void sub(
+    constexpr void sub(
         const BasicTime& amount
     );
 
@@ -549,7 +615,7 @@ public:
     /// \return New time added with \a rhs
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void sub(
+    constexpr void sub(
         const auto& amount
     );
 
@@ -570,7 +636,7 @@ public:
     /// \return New time added with \a rhs
     ///
     ///////////////////////////////////////////////////////////////////////////
-    auto operator*=(
+    constexpr auto operator*=(
         const auto& rhs
     ) -> BasicTime&;
 
@@ -601,7 +667,7 @@ public:
     /// \return New time added with \a rhs
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void mul(
+    constexpr void mul(
         const auto& amount
     );
 
@@ -622,7 +688,7 @@ public:
     /// \return New time added with \a rhs
     ///
     ///////////////////////////////////////////////////////////////////////////
-    auto operator/=(
+    constexpr auto operator/=(
         const auto& rhs
     ) -> BasicTime&;
 
@@ -653,7 +719,7 @@ public:
     /// \return New time added with \a rhs
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void div(
+    constexpr void div(
         const auto& amount
     );
 
@@ -674,7 +740,7 @@ public:
     /// \return New time added with \a rhs
     ///
     ///////////////////////////////////////////////////////////////////////////
-    auto operator%=(
+    constexpr auto operator%=(
         const auto& rhs
     ) -> BasicTime&;
 
@@ -705,7 +771,7 @@ public:
     /// \return New time added with \a rhs
     ///
     ///////////////////////////////////////////////////////////////////////////
-    void mod(
+    constexpr void mod(
         const auto& amount
     );
 
@@ -713,7 +779,46 @@ public:
 
 private:
 
-    BasicTime::Type m_time;
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Converts an amount from a unit to another
+    ///
+    /// The factor is computed at compile time. Integral amounts stay
+    /// integral, others are computed as at least double.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    template <
+        typename FromPeriod
+        , typename ToPeriod = BasicTime::Period
+    > [[ nodiscard ]] static constexpr auto convert(
+        const auto& amount
+    ) noexcept
+        -> BasicTime::Type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Value of amount in Period units
+    ///
+    /// A ::xrn::util::BasicTime or a ::std::chrono::duration is converted
+    /// from its own unit, any other value is considered as already in Period
+    /// units.
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] static constexpr auto toType(
+        const auto& amount
+    ) noexcept
+        -> BasicTime::Type;
+
+
+
+private:
+
+    BasicTime::Type m_time{ 0 };
 
 };
 
@@ -725,7 +830,9 @@ private:
 // Template specialization
 ///////////////////////////////////////////////////////////////////////////
 namespace xrn::util { using Time = ::xrn::util::BasicTime<float>; }
+namespace xrn::util { using NanoTime = ::xrn::util::BasicTime<::std::int64_t, ::std::nano>; }
 namespace xrn { using Time = ::xrn::util::Time; }
+namespace xrn { using NanoTime = ::xrn::util::NanoTime; }
 
 
 
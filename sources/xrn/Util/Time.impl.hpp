@@ -3,41 +3,58 @@
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::createAsSeconds(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::createAsSeconds(
     const auto& amount
 ) noexcept -> BasicTime
 {
-    return BasicTime{ static_cast<BasicTime::Type>(amount) * 1'000 };
+    return BasicTime{ BasicTime::convert<::std::ratio<1>>(amount) };
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::createAsMilliseconds(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::createAsMilliseconds(
     const auto& amount
 ) noexcept -> BasicTime
 {
-    return BasicTime{ static_cast<BasicTime::Type>(amount) };
+    return BasicTime{ BasicTime::convert<::std::milli>(amount) };
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::createAsMicroseconds(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::createAsMicroseconds(
     const auto& amount
 ) noexcept -> BasicTime
 {
-    return BasicTime{ static_cast<BasicTime::Type>(amount) / 1'000 };
+    return BasicTime{ BasicTime::convert<::std::micro>(amount) };
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::createAsNanoseconds(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::createAsNanoseconds(
     const auto& amount
 ) noexcept -> BasicTime
 {
-    return BasicTime{ static_cast<BasicTime::Type>(amount) / 1'000'000 };
+    return BasicTime{ BasicTime::convert<::std::nano>(amount) };
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename T
+    , typename Unit
+> template <
+    typename FromUnit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::createAs(
+    const auto& amount
+) noexcept -> BasicTime
+{
+    return BasicTime{ BasicTime::convert<FromUnit>(amount) };
 }
 
 
@@ -51,15 +68,17 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr ::xrn::util::BasicTime<T>::BasicTime() noexcept = default;
+    , typename Unit
+> constexpr ::xrn::util::BasicTime<T, Unit>::BasicTime() noexcept = default;
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr ::xrn::util::BasicTime<T>::BasicTime(
+    , typename Unit
+> constexpr ::xrn::util::BasicTime<T, Unit>::BasicTime(
     auto amount
 ) noexcept
-    : m_time{ static_cast<BasicTime::Type>(amount) }
+    : m_time{ BasicTime::toType(amount) }
 {}
 
 
@@ -74,7 +93,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::operator<=>(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator<=>(
     const BasicTime& rhs
 ) const
     -> ::std::partial_ordering
@@ -85,12 +105,41 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::operator<=>(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator<=>(
     const auto& rhs
 ) const
     -> ::std::partial_ordering
 {
-    return m_time <=> rhs;
+    if constexpr (::std::is_arithmetic_v<::std::remove_cvref_t<decltype(rhs)>>) {
+        return m_time <=> rhs;
+    } else {
+        return m_time <=> BasicTime::toType(rhs);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename T
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator==(
+    const BasicTime& rhs
+) const
+    -> bool
+{
+    return m_time == rhs.m_time;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename T
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator==(
+    const auto& rhs
+) const
+    -> bool
+{
+    return (*this <=> rhs) == 0;
 }
 
 
@@ -105,7 +154,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr ::xrn::util::BasicTime<T>::operator BasicTime::Type() const noexcept
+    , typename Unit
+> constexpr ::xrn::util::BasicTime<T, Unit>::operator BasicTime::Type() const noexcept
 {
     return m_time;
 }
@@ -113,7 +163,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::operator*() const noexcept
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator*() const noexcept
     -> BasicTime::Type
 {
     return m_time;
@@ -122,7 +173,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::get() const
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::get() const
     -> BasicTime::Type
 {
     return m_time;
@@ -131,73 +183,101 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::getAsSeconds() const
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::getAsSeconds() const
     -> BasicTime::Type
 {
-    return m_time / 1'000;
+    return BasicTime::convert<BasicTime::Period, ::std::ratio<1>>(m_time);
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::getAsMilliseconds() const
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::getAsMilliseconds() const
     -> BasicTime::Type
 {
-    return m_time;
+    return BasicTime::convert<BasicTime::Period, ::std::milli>(m_time);
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename T
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::getAsMicroseconds() const
+    -> BasicTime::Type
+{
+    return BasicTime::convert<BasicTime::Period, ::std::micro>(m_time);
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::getAsMicroseconds() const
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::getAsNanoseconds() const
     -> BasicTime::Type
 {
-    return m_time * 1'000;
+    return BasicTime::convert<BasicTime::Period, ::std::nano>(m_time);
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::getAsNanoseconds() const
+    , typename Unit
+> template <
+    typename ToUnit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::getAs() const
     -> BasicTime::Type
 {
-    return m_time * 1'000'000;
+    return BasicTime::convert<BasicTime::Period, ToUnit>(m_time);
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::getAsChronoSeconds() const
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::getAsChronoSeconds() const
     -> ::std::chrono::duration<BasicTime::Type>
 {
-    return ::std::chrono::duration<BasicTime::Type, ::std::milli>{ m_time / 1'000 };
+    return ::std::chrono::duration_cast<::std::chrono::duration<BasicTime::Type>>(
+        ::std::chrono::duration<BasicTime::Type, BasicTime::Period>{ m_time }
+    );
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::getAsChronoMilliseconds() const
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::getAsChronoMilliseconds() const
     -> ::std::chrono::duration<BasicTime::Type, ::std::milli>
 {
-    return ::std::chrono::duration<BasicTime::Type, ::std::milli>{ m_time };
+    return ::std::chrono::duration_cast<::std::chrono::duration<BasicTime::Type, ::std::milli>>(
+        ::std::chrono::duration<BasicTime::Type, BasicTime::Period>{ m_time }
+    );
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::getAsChronoMicroseconds() const
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::getAsChronoMicroseconds() const
     -> ::std::chrono::duration<BasicTime::Type, ::std::micro>
 {
-    return ::std::chrono::duration<BasicTime::Type, ::std::milli>{ m_time * 1'000 };
+    return ::std::chrono::duration_cast<::std::chrono::duration<BasicTime::Type, ::std::micro>>(
+        ::std::chrono::duration<BasicTime::Type, BasicTime::Period>{ m_time }
+    );
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::getAsChronoNanoseconds() const
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::getAsChronoNanoseconds() const
     -> ::std::chrono::duration<BasicTime::Type, ::std::nano>
 {
-    return ::std::chrono::duration<BasicTime::Type, ::std::milli>{ m_time * 1'000'000 };
+    return ::std::chrono::duration_cast<::std::chrono::duration<BasicTime::Type, ::std::nano>>(
+        ::std::chrono::duration<BasicTime::Type, BasicTime::Period>{ m_time }
+    );
 }
 
 
@@ -212,18 +292,20 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> auto ::xrn::util::BasicTime<T>::operator=(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator=(
     const auto& amount
 ) -> BasicTime&
 {
-    m_time = static_cast<T>(amount);
+    m_time = BasicTime::toType(amount);
     return *this;
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> void ::xrn::util::BasicTime<T>::set(
+    , typename Unit
+> constexpr void ::xrn::util::BasicTime<T, Unit>::set(
     const BasicTime& amount
 )
 {
@@ -233,11 +315,12 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> void ::xrn::util::BasicTime<T>::set(
+    , typename Unit
+> constexpr void ::xrn::util::BasicTime<T, Unit>::set(
     const auto& amount
 )
 {
-    m_time = static_cast<T>(amount);
+    m_time = BasicTime::toType(amount);
 }
 
 
@@ -252,7 +335,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> auto ::xrn::util::BasicTime<T>::operator+=(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator+=(
     const BasicTime& rhs
 ) -> BasicTime&
 {
@@ -263,18 +347,20 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> auto ::xrn::util::BasicTime<T>::operator+=(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator+=(
     const auto& rhs
 ) -> BasicTime&
 {
-    m_time += static_cast<T>(rhs);
+    m_time += BasicTime::toType(rhs);
     return *this;
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::operator+(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator+(
     const BasicTime& rhs
 ) const
     -> BasicTime
@@ -287,7 +373,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::operator+(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator+(
     const auto& rhs
 ) const
     -> BasicTime
@@ -300,7 +387,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> void ::xrn::util::BasicTime<T>::add(
+    , typename Unit
+> constexpr void ::xrn::util::BasicTime<T, Unit>::add(
     const BasicTime& amount
 )
 {
@@ -310,11 +398,12 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> void ::xrn::util::BasicTime<T>::add(
+    , typename Unit
+> constexpr void ::xrn::util::BasicTime<T, Unit>::add(
     const auto& amount
 )
 {
-    m_time += static_cast<T>(amount);
+    m_time += BasicTime::toType(amount);
 }
 
 
@@ -329,7 +418,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> auto ::xrn::util::BasicTime<T>::operator-=(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator-=(
     const BasicTime& rhs
 ) -> BasicTime&
 {
@@ -340,18 +430,20 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> auto ::xrn::util::BasicTime<T>::operator-=(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator-=(
     const auto& rhs
 ) -> BasicTime&
 {
-    m_time -= static_cast<T>(rhs);
+    m_time -= BasicTime::toType(rhs);
     return *this;
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::operator-(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator-(
     const BasicTime& rhs
 ) const
     -> BasicTime
@@ -364,7 +456,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::operator-(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator-(
     const auto& rhs
 ) const
     -> BasicTime
@@ -377,7 +470,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> void ::xrn::util::BasicTime<T>::sub(
+    , typename Unit
+> constexpr void ::xrn::util::BasicTime<T, Unit>::sub(
     const BasicTime& amount
 )
 {
@@ -387,11 +481,12 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> void ::xrn::util::BasicTime<T>::sub(
+    , typename Unit
+> constexpr void ::xrn::util::BasicTime<T, Unit>::sub(
     const auto& amount
 )
 {
-    m_time -= static_cast<T>(amount);
+    m_time -= BasicTime::toType(amount);
 }
 
 
@@ -406,7 +501,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> auto ::xrn::util::BasicTime<T>::operator*=(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator*=(
     const auto& rhs
 ) -> BasicTime&
 {
@@ -417,7 +513,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::operator*(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator*(
     const auto& rhs
 ) const
     -> BasicTime
@@ -430,7 +527,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> void ::xrn::util::BasicTime<T>::mul(
+    , typename Unit
+> constexpr void ::xrn::util::BasicTime<T, Unit>::mul(
     const auto& amount
 )
 {
@@ -449,7 +547,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> auto ::xrn::util::BasicTime<T>::operator/=(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator/=(
     const auto& rhs
 ) -> BasicTime&
 {
@@ -460,7 +559,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::operator/(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator/(
     const auto& rhs
 ) const
     -> BasicTime
@@ -473,7 +573,8 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> void ::xrn::util::BasicTime<T>::div(
+    , typename Unit
+> constexpr void ::xrn::util::BasicTime<T, Unit>::div(
     const auto& amount
 )
 {
@@ -492,21 +593,20 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> auto ::xrn::util::BasicTime<T>::operator%=(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator%=(
     const auto& rhs
 ) -> BasicTime&
 {
-    auto newValue{
-        static_cast<::std::uint_fast32_t>(m_time) % static_cast<::std::uint_fast32_t>(rhs)
-    };
-    m_time = static_cast<T>(newValue);
+    this->mod(rhs);
     return *this;
 }
 
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> constexpr auto ::xrn::util::BasicTime<T>::operator%(
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::operator%(
     const auto& rhs
 ) const
     -> BasicTime
@@ -519,14 +619,78 @@ template <
 ///////////////////////////////////////////////////////////////////////////
 template <
     typename T
-> void ::xrn::util::BasicTime<T>::mod(
+    , typename Unit
+> constexpr void ::xrn::util::BasicTime<T, Unit>::mod(
     const auto& amount
 )
 {
-    auto newValue{
-        static_cast<::std::uint_fast32_t>(m_time) % static_cast<::std::uint_fast32_t>(amount)
-    };
-    m_time = static_cast<T>(newValue);
+    if constexpr (::std::is_integral_v<T>) {
+        m_time %= BasicTime::toType(amount);
+    } else {
+        auto newValue{
+            static_cast<::std::uint_fast32_t>(m_time) %
+            static_cast<::std::uint_fast32_t>(BasicTime::toType(amount))
+        };
+        m_time = static_cast<T>(newValue);
+    }
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename T
+    , typename Unit
+> template <
+    typename FromPeriod
+    , typename ToPeriod
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::convert(
+    const auto& amount
+) noexcept
+    -> BasicTime::Type
+{
+    using Factor = ::std::ratio_divide<FromPeriod, ToPeriod>;
+    if constexpr (
+        ::std::is_floating_point_v<T> ||
+        ::std::is_floating_point_v<::std::remove_cvref_t<decltype(amount)>>
+    ) {
+        // a single multiplication, double keeps float results correctly rounded
+        using Compute = ::std::common_type_t<T, double>;
+        constexpr auto factor{ static_cast<Compute>(Factor::num) / static_cast<Compute>(Factor::den) };
+        return static_cast<T>(static_cast<Compute>(amount) * factor);
+    } else {
+        return static_cast<T>(amount) * static_cast<T>(Factor::num) / static_cast<T>(Factor::den);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename T
+    , typename Unit
+> constexpr auto ::xrn::util::BasicTime<T, Unit>::toType(
+    const auto& amount
+) noexcept
+    -> BasicTime::Type
+{
+    using Amount = ::std::remove_cvref_t<decltype(amount)>;
+    if constexpr (requires {
+        requires ::std::same_as<Amount, ::xrn::util::BasicTime<typename Amount::Type, typename Amount::Period>>;
+    }) {
+        return BasicTime::convert<typename Amount::Period>(amount.get());
+    } else if constexpr (requires {
+        requires ::std::same_as<Amount, ::std::chrono::duration<typename Amount::rep, typename Amount::period>>;
+    }) {
+        return BasicTime::convert<typename Amount::period>(amount.count());
+    } else {
+        return static_cast<T>(amount);
+    }
 }
 
 
@@ -603,9 +767,9 @@ template <
 }
 
 ///////////////////////////////////////////////////////////////////////////
-template <> struct fmt::formatter<::xrn::Time> {
+template <typename T, typename Unit> struct fmt::formatter<::xrn::util::BasicTime<T, Unit>> {
     constexpr auto parse(format_parse_context& ctx) -> decltype(ctx.begin()){ return ctx.begin(); }
-    template <typename FormatContext> auto format(const ::xrn::Time& t, FormatContext& ctx) -> decltype(ctx.out()){
+    template <typename FormatContext> auto format(const ::xrn::util::BasicTime<T, Unit>& t, FormatContext& ctx) -> decltype(ctx.out()){
         return format_to( ctx.out(), "{}", t.get());
     }
 };
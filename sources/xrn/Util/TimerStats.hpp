@@ -0,0 +1,177 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+// Headers
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/Time.hpp>
+
+
+
+namespace xrn::util {
+
+///////////////////////////////////////////////////////////////////////////
+/// \brief Aggregated statistics of a series of durations
+/// \ingroup util
+///
+/// \include TimerStats.hpp <xrn/Util/TimerStats.hpp>
+///
+/// ::xrn::util::TimerStats keeps the count, sum, minimum, maximum, mean and
+/// variance of the durations recorded, in constant space. The variance is
+/// updated with Welford's algorithm, and two statistics are merged with
+/// Chan's parallel algorithm, so per-thread statistics can be combined
+/// without losing precision.
+/// The class is trivially copyable, it is mostly produced by
+/// ::xrn::util::ScopedTimer::getSnapshot().
+///
+/// Usage example:
+/// \code
+/// ::xrn::TimerStats stats;
+/// stats.record(::xrn::Time{ 3 });
+/// stats.merge(otherStats);
+/// auto mean{ stats.getMean() };
+/// \endcode
+///
+/// \see ::xrn::util::ScopedTimer
+///
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename TimeType = ::xrn::util::BasicTime<double>
+> class TimerStats {
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static elements
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Type of the durations, its internal type must be floating
+    ///        point
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    using Time = TimeType;
+
+    static_assert(::std::is_floating_point_v<typename Time::Type>);
+
+
+
+public:
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Basic
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Adds a duration to the statistics
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr void record(
+        const TimerStats::Time& duration
+    ) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Adds the durations recorded by other statistics, as if they
+    ///        were recorded by this one
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr void merge(
+        const TimerStats& that
+    ) noexcept;
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Getters
+    //
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Amount of durations recorded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto getCount() const noexcept
+        -> ::std::uint64_t;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Sum of the durations recorded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto getSum() const noexcept
+        -> TimerStats::Time;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Shortest duration recorded, 0 if none
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto getMin() const noexcept
+        -> TimerStats::Time;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Longest duration recorded, 0 if none
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto getMax() const noexcept
+        -> TimerStats::Time;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Mean of the durations recorded, 0 if none
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto getMean() const noexcept
+        -> TimerStats::Time;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Population variance of the durations recorded, in squared
+    ///        units of Time
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] constexpr auto getVariance() const noexcept
+        -> typename TimerStats::Time::Type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Population standard deviation of the durations recorded
+    ///
+    ///////////////////////////////////////////////////////////////////////////
+    [[ nodiscard ]] auto getStandardDeviation() const noexcept
+        -> TimerStats::Time;
+
+
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Welford's running values, m_squaredDistance is the sum of the squared
+    // distances to the mean
+    ///////////////////////////////////////////////////////////////////////////
+    ::std::uint64_t m_count{ 0 };
+    typename TimerStats::Time::Type m_sum{ 0 };
+    typename TimerStats::Time::Type m_min{ ::std::numeric_limits<typename TimerStats::Time::Type>::infinity() };
+    typename TimerStats::Time::Type m_max{ -::std::numeric_limits<typename TimerStats::Time::Type>::infinity() };
+    typename TimerStats::Time::Type m_mean{ 0 };
+    typename TimerStats::Time::Type m_squaredDistance{ 0 };
+
+};
+
+} // namespace xrn::util
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Template specialization
+///////////////////////////////////////////////////////////////////////////
+namespace xrn { template <typename TimeType = ::xrn::util::BasicTime<double>> using TimerStats = ::xrn::util::TimerStats<TimeType>; }
+
+
+
+///////////////////////////////////////////////////////////////////////////
+// Header-implimentation
+///////////////////////////////////////////////////////////////////////////
+#include <xrn/Util/TimerStats.impl.hpp>
@@ -0,0 +1,124 @@
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Basic
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename TimeType
+> constexpr void ::xrn::util::TimerStats<TimeType>::record(
+    const TimerStats::Time& duration
+) noexcept
+{
+    const auto value{ duration.get() };
+    ++m_count;
+    m_sum += value;
+    m_min = ::std::min(m_min, value);
+    m_max = ::std::max(m_max, value);
+    const auto distance{ value - m_mean };
+    m_mean += distance / static_cast<typename TimerStats::Time::Type>(m_count);
+    m_squaredDistance += distance * (value - m_mean);
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename TimeType
+> constexpr void ::xrn::util::TimerStats<TimeType>::merge(
+    const TimerStats& that
+) noexcept
+{
+    if (!that.m_count) {
+        return;
+    }
+    if (!m_count) {
+        *this = that;
+        return;
+    }
+    using Type = typename TimerStats::Time::Type;
+    const auto count{ m_count + that.m_count };
+    const auto distance{ that.m_mean - m_mean };
+    const auto weight{ static_cast<Type>(that.m_count) / static_cast<Type>(count) };
+    m_squaredDistance += that.m_squaredDistance +
+        distance * distance * static_cast<Type>(m_count) * weight;
+    m_mean += distance * weight;
+    m_count = count;
+    m_sum += that.m_sum;
+    m_min = ::std::min(m_min, that.m_min);
+    m_max = ::std::max(m_max, that.m_max);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+// Getters
+//
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename TimeType
+> constexpr auto ::xrn::util::TimerStats<TimeType>::getCount() const noexcept
+    -> ::std::uint64_t
+{
+    return m_count;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename TimeType
+> constexpr auto ::xrn::util::TimerStats<TimeType>::getSum() const noexcept
+    -> TimerStats::Time
+{
+    return TimerStats::Time{ m_sum };
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename TimeType
+> constexpr auto ::xrn::util::TimerStats<TimeType>::getMin() const noexcept
+    -> TimerStats::Time
+{
+    return TimerStats::Time{ m_count ? m_min : 0 };
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename TimeType
+> constexpr auto ::xrn::util::TimerStats<TimeType>::getMax() const noexcept
+    -> TimerStats::Time
+{
+    return TimerStats::Time{ m_count ? m_max : 0 };
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename TimeType
+> constexpr auto ::xrn::util::TimerStats<TimeType>::getMean() const noexcept
+    -> TimerStats::Time
+{
+    return TimerStats::Time{ m_mean };
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename TimeType
+> constexpr auto ::xrn::util::TimerStats<TimeType>::getVariance() const noexcept
+    -> typename TimerStats::Time::Type
+{
+    return m_count ? m_squaredDistance / static_cast<typename TimerStats::Time::Type>(m_count) : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <
+    typename TimeType
+> auto ::xrn::util::TimerStats<TimeType>::getStandardDeviation() const noexcept
+    -> TimerStats::Time
+{
+    return TimerStats::Time{ ::std::sqrt(this->getVariance()) };
+}
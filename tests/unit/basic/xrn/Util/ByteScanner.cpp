@@ -0,0 +1,82 @@
+#include <pch.hpp>
+#include <catch2/catch.hpp>
+#include <xrn/Util/ByteScanner.hpp>
+
+namespace {
+
+///////////////////////////////////////////////////////////////////////////
+// Every instruction set supported by the machine running the tests
+///////////////////////////////////////////////////////////////////////////
+auto getTestedIsas()
+    -> ::std::vector<::xrn::ByteScanner::Isa>
+{
+    ::std::vector<::xrn::ByteScanner::Isa> isas{ ::xrn::ByteScanner::Isa::scalar };
+    if (::xrn::ByteScanner::getSupportedIsa() >= ::xrn::ByteScanner::Isa::sse2) {
+        isas.push_back(::xrn::ByteScanner::Isa::sse2);
+    }
+    if (::xrn::ByteScanner::getSupportedIsa() >= ::xrn::ByteScanner::Isa::avx2) {
+        isas.push_back(::xrn::ByteScanner::Isa::avx2);
+    }
+    return isas;
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Buffer with delimiters at irregular positions, crossing every block size
+///////////////////////////////////////////////////////////////////////////
+auto createBuffer()
+    -> ::std::string
+{
+    ::std::string buffer;
+    for (auto i{ 0uz }; i < 300; ++i) {
+        buffer += ::std::string(i % 37, 'a') + (i % 3 ? '\n' : ';');
+    }
+    return buffer;
+}
+
+} // namespace
+
+TEST_CASE(" xrnUtil :: ByteScanner.Find01")
+{
+    const auto buffer{ ::createBuffer() };
+    const auto* first{ buffer.data() };
+    const auto* last{ buffer.data() + buffer.size() };
+
+    for (auto isa : ::getTestedIsas()) {
+        ::xrn::ByteScanner::setIsa(isa);
+        for (auto offset{ 0uz }; offset < 100; ++offset) {
+            REQUIRE(::xrn::ByteScanner::find(first + offset, last, '\n') == ::std::find(first + offset, last, '\n'));
+            REQUIRE(::xrn::ByteScanner::find(first + offset, last, '#') == last);
+            REQUIRE(
+                ::xrn::ByteScanner::findAny(first + offset, last, ';', '#', '#')
+                == ::std::find_first_of(first + offset, last, ";#", ";#" + 2)
+            );
+        }
+    }
+    ::xrn::ByteScanner::setIsa(::xrn::ByteScanner::getSupportedIsa());
+}
+
+TEST_CASE(" xrnUtil :: ByteScanner.ForEach01")
+{
+    const auto buffer{ ::createBuffer() };
+    const auto* first{ buffer.data() };
+    const auto* last{ buffer.data() + buffer.size() };
+
+    ::std::vector<const char*> expected;
+    for (const auto* it{ first }; it != last; ++it) {
+        if (*it == '\n') {
+            expected.push_back(it);
+        }
+    }
+
+    for (auto isa : ::getTestedIsas()) {
+        ::xrn::ByteScanner::setIsa(isa);
+        ::std::vector<const char*> found;
+        ::xrn::ByteScanner::forEach(first, last, '\n', [&found](const char* it){ found.push_back(it); });
+        REQUIRE(found == expected);
+        REQUIRE(::xrn::ByteScanner::count(first, last, '\n') == expected.size());
+    }
+    ::xrn::ByteScanner::setIsa(::xrn::ByteScanner::getSupportedIsa());
+
+    REQUIRE(::xrn::ByteScanner::trimCarriageReturn("line\r") == "line");
+    REQUIRE(::xrn::ByteScanner::trimCarriageReturn("line") == "line");
+}
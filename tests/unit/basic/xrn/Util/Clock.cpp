@@ -3,6 +3,8 @@
 #include <xrn/Util/Clock.hpp>
 
 template class ::xrn::util::BasicClock<::xrn::Time>;
+template class ::xrn::util::BasicClock<::xrn::Time, ::xrn::util::clockSource::Tsc>;
+template class ::xrn::util::BasicClock<::xrn::NanoTime>;
 
 using TestingClock = ::xrn::util::BasicClock<::xrn::Time>;
 
@@ -16,3 +18,82 @@ TEST_CASE(" xrnUtil :: Clock.Basic01")
 
     REQUIRE(t1 < t2);
 }
+
+TEST_CASE(" xrnUtil :: Clock.Tsc01")
+{
+    using Tsc = ::xrn::util::clockSource::Tsc;
+    static_assert(::std::chrono::is_clock_v<Tsc>);
+    if (Tsc::isInvariant()) {
+        REQUIRE(Tsc::getFrequency() > 0);
+    } else {
+        REQUIRE(Tsc::getFrequency() == 0);
+    }
+
+    // same epoch as CLOCK_MONOTONIC, which steady_clock uses on linux
+    const auto offset{ Tsc::now().time_since_epoch() - ::std::chrono::steady_clock::now().time_since_epoch() };
+    REQUIRE(::std::chrono::abs(offset) < ::std::chrono::milliseconds{ 5 });
+
+    ::xrn::TscClock clock;
+    ::std::this_thread::sleep_for(::std::chrono::milliseconds{ 20 });
+    const auto t1{ clock.restart() };
+    REQUIRE(t1 >= 19);
+    REQUIRE(t1 < 500);
+    REQUIRE(clock.getElapsed() < t1);
+}
+
+TEST_CASE(" xrnUtil :: Clock.Source01")
+{
+    ::xrn::SteadyClock steadyClock;
+    ::xrn::CoarseClock coarseClock;
+    ::xrn::RawClock rawClock;
+    ::xrn::ThreadCpuClock threadCpuClock;
+    ::std::this_thread::sleep_for(::std::chrono::milliseconds{ 20 });
+
+    REQUIRE(steadyClock.getElapsed() >= 19);
+    REQUIRE(rawClock.getElapsed() >= 19);
+    // precise to a tick only
+    const auto resolution{ ::std::chrono::duration<float, ::std::milli>{
+        ::xrn::util::clockSource::MonotonicCoarse::getResolution()
+    }.count() };
+    REQUIRE(coarseClock.getElapsed() >= 19 - resolution);
+    // sleeping does not use the CPU
+    REQUIRE(threadCpuClock.restart() < 10);
+
+    auto volatile sum{ 0uz };
+    while (threadCpuClock.getElapsed() < 5) {
+        sum = sum + 1;
+    }
+    REQUIRE(threadCpuClock.getElapsed() >= 5);
+}
+
+TEST_CASE(" xrnUtil :: Clock.Manual01")
+{
+    struct Tag;
+    using Source = ::xrn::util::clockSource::Manual<Tag>;
+    ::xrn::util::BasicClock<::xrn::Time, Source> clock;
+    REQUIRE(clock.getElapsed() == 0);
+
+    Source::advance(::std::chrono::milliseconds{ 250 });
+    REQUIRE(clock.getElapsed() == 250);
+    Source::advance(::std::chrono::microseconds{ 500 });
+    REQUIRE(clock.restart() == 250.5f);
+    REQUIRE(clock.getElapsed() == 0);
+
+    // other tags are independent
+    REQUIRE(::xrn::util::clockSource::Manual<>::now().time_since_epoch().count() == 0);
+    Source::reset();
+    REQUIRE(Source::now().time_since_epoch().count() == 0);
+}
+
+TEST_CASE(" xrnUtil :: Clock.Nano01")
+{
+    struct Tag;
+    using Source = ::xrn::util::clockSource::Manual<Tag>;
+    ::xrn::util::BasicClock<::xrn::NanoTime, Source> clock;
+    Source::advance(::std::chrono::hours{ 100 } + ::std::chrono::nanoseconds{ 1 });
+    REQUIRE(clock.restart().get() == 360'000'000'000'001);
+
+    ::xrn::NanoClock nanoClock;
+    ::std::this_thread::sleep_for(::std::chrono::milliseconds{ 20 });
+    REQUIRE(nanoClock.getElapsed().getAsMilliseconds() >= 19);
+}
@@ -0,0 +1,825 @@
+#include <pch.hpp>
+#include <sys/resource.h>
+#include <catch2/catch.hpp>
+#include <xrn/Util/File.hpp>
+#include "TemporaryDirectory.hpp"
+
+TEST_CASE(" xrnUtil :: File.Map01")
+{
+    const ::TemporaryDirectory directory{ "File.Map01" };
+
+    const auto filepath{ directory.createFile("Map01", "first\nsecond\nthird") };
+
+    auto mapped{ ::xrn::File::map(filepath, ::xrn::MappedFile::Advice::sequential) };
+    REQUIRE(mapped.getView() == "first\nsecond\nthird");
+    REQUIRE(mapped.getBytes().size() == mapped.size());
+
+    auto moved{ ::std::move(mapped) };
+    REQUIRE(mapped.empty());
+    REQUIRE(moved.size() == 18);
+}
+
+TEST_CASE(" xrnUtil :: File.Map02")
+{
+    const ::TemporaryDirectory directory{ "File.Map02" };
+
+    const auto filepath{ directory.createFile("Map02", "") };
+
+    auto mapped{ ::xrn::File::map(filepath) };
+    REQUIRE(mapped.empty());
+    REQUIRE(mapped.getView().empty());
+
+    REQUIRE_THROWS_AS(::xrn::File::map(filepath + ".missing"), ::std::system_error);
+}
+
+TEST_CASE(" xrnUtil :: File.Lines01")
+{
+    const ::TemporaryDirectory directory{ "File.Lines01" };
+
+    const auto filepath{ directory.createFile("Lines01", "first\n\nthird line\nlast") };
+
+    ::std::vector<::std::string> lines;
+    for (auto line : ::xrn::File::lines(filepath, 4)) { // smaller than a line to force growth
+        lines.emplace_back(line);
+    }
+    REQUIRE(lines == ::xrn::File::getContentAsVector(filepath));
+    REQUIRE(lines.size() == 4);
+    REQUIRE(lines[2] == "third line");
+
+    static_assert(::std::ranges::input_range<::xrn::LineReader>);
+    auto reader{ ::xrn::File::lines(filepath) };
+    auto nonEmpty{ reader | ::std::views::filter([](auto line){ return !line.empty(); }) };
+    REQUIRE(::std::ranges::distance(nonEmpty) == 3);
+}
+
+TEST_CASE(" xrnUtil :: File.Lines02")
+{
+    const ::TemporaryDirectory directory{ "File.Lines02" };
+
+    const auto filepath{ directory.createFile("Lines02", "a\nb\n") };
+
+    auto reader{ ::xrn::File::lines(filepath) };
+    REQUIRE(reader.next());
+    REQUIRE(reader.getLine() == "a");
+    REQUIRE(reader.next());
+    REQUIRE(reader.getLine() == "b");
+    REQUIRE_FALSE(reader.next());
+}
+
+TEST_CASE(" xrnUtil :: File.LineTable01")
+{
+    const ::TemporaryDirectory directory{ "File.LineTable01" };
+
+    const auto filepath{ directory.createFile("LineTable01", "first\n\nthird line\nlast") };
+
+    const auto table{ ::xrn::File::getLineTable(filepath) };
+    const auto expected{ ::xrn::File::getContentAsVector(filepath) };
+    REQUIRE(table.size() == expected.size());
+    REQUIRE(::std::ranges::equal(table, expected));
+    REQUIRE(table[1].empty());
+    REQUIRE(table.getLine(3) == "last");
+    REQUIRE_THROWS_AS(table.getLine(4), ::std::out_of_range);
+
+    static_assert(::std::ranges::random_access_range<::xrn::LineTable>);
+    REQUIRE(*(table.end() - 2) == "third line");
+}
+
+TEST_CASE(" xrnUtil :: File.LineTable02")
+{
+    const ::TemporaryDirectory directory{ "File.LineTable02" };
+
+    const auto emptyTable{ ::xrn::File::getLineTable(directory.createFile("LineTable02a", "")) };
+    REQUIRE(emptyTable.empty());
+
+    const auto table{ ::xrn::File::getLineTable<::std::uint32_t>(directory.createFile("LineTable02b", "\na\n")) };
+    REQUIRE(table.size() == 2);
+    REQUIRE(table[0] == "");
+    REQUIRE(table[1] == "a");
+    REQUIRE(table.getOffsets().size() == 3);
+}
+
+TEST_CASE(" xrnUtil :: File.Records01")
+{
+    const ::TemporaryDirectory directory{ "File.Records01" };
+
+    const auto filepath{ directory.createFile("Records01", "a\r\nb\r\nc;d") };
+
+    REQUIRE(::xrn::File::getContentAsVector(filepath) == ::std::vector<::std::string>{ "a", "b", "c;d" });
+    REQUIRE(*::xrn::File::tryGetContentAsVector(filepath) == ::std::vector<::std::string>{ "a", "b", "c;d" });
+    REQUIRE(*::xrn::File::tryGetContentAsVector(directory.createFile("Records01.empty", "\n")) == ::std::vector<::std::string>{ "" });
+
+    const auto table{ ::xrn::File::getLineTable(filepath) };
+    REQUIRE(table[0] == "a");
+    REQUIRE(table[2] == "c;d");
+
+    ::std::vector<::std::string> records;
+    for (auto record : ::xrn::File::records(filepath, ';')) {
+        records.emplace_back(record);
+    }
+    REQUIRE(records == ::std::vector<::std::string>{ "a\r\nb\r\nc", "d" });
+    REQUIRE(::xrn::File::getRecordTable(filepath, ';')[0] == "a\r\nb\r\nc");
+}
+
+TEST_CASE(" xrnUtil :: File.LineTable03")
+{
+    const ::TemporaryDirectory directory{ "File.LineTable03" };
+
+    ::std::string content;
+    for (auto i{ 0uz }; i < 1'500'000; ++i) {
+        content += ::std::to_string(i) + (i % 7 ? "\n" : "\r\n");
+    }
+    const auto filepath{ directory.createFile("LineTable03", content) };
+
+    const auto table{ ::xrn::File::getLineTable(filepath) };
+    const auto parallelTable{ ::xrn::File::getLineTable(filepath, 4) };
+    REQUIRE(parallelTable.size() == 1'500'000);
+    REQUIRE(::std::ranges::equal(parallelTable.getOffsets(), table.getOffsets()));
+    REQUIRE(parallelTable[1'499'999] == "1499999");
+}
+
+TEST_CASE(" xrnUtil :: File.ReadInto01")
+{
+    const ::TemporaryDirectory directory{ "File.ReadInto01" };
+
+    const auto filepath{ directory.createFile("ReadInto01", "some content") };
+
+    REQUIRE(::xrn::File::getContent(filepath) == "some content");
+
+    ::std::string content;
+    content.reserve(64);
+    const auto* buffer{ content.data() };
+    ::xrn::File::readInto(filepath, content);
+    REQUIRE(content == "some content");
+    ::xrn::File::readInto(filepath, content);
+    REQUIRE(content == "some content");
+    REQUIRE(content.data() == buffer);
+
+    ::std::vector<::std::byte> bytes;
+    ::xrn::File::readInto(filepath, bytes);
+    REQUIRE(bytes.size() == 12);
+    REQUIRE(bytes[0] == ::std::byte{ 's' });
+
+    REQUIRE_THROWS_AS(::xrn::File::readInto(filepath + ".missing", content), ::std::system_error);
+}
+
+TEST_CASE(" xrnUtil :: File.LoadMany01")
+{
+    const ::TemporaryDirectory directory{ "File.LoadMany01" };
+
+    const ::std::vector<::std::string> filenames{
+        directory.createFile("LoadMany01a", "first")
+        , directory.createFile("LoadMany01b", ::std::string(300'000, 'b'))
+        , directory.createFile("LoadMany01c", "")
+        , "/proc/self/status"
+        , directory.createFile("LoadMany01d", "last") + ".missing"
+    };
+
+    auto futures{ ::xrn::File::loadMany(filenames) };
+    REQUIRE(futures.size() == 5);
+    REQUIRE(futures[0].get() == "first");
+    REQUIRE(futures[1].get() == ::std::string(300'000, 'b'));
+    REQUIRE(futures[2].get().empty());
+    REQUIRE(futures[3].get().starts_with("Name:"));
+    REQUIRE_THROWS_AS(futures[4].get(), ::std::system_error);
+
+    // destroyed before being read, waits for the loading thread
+    {
+        auto unread{ ::xrn::File::loadMany(filenames) };
+        REQUIRE(unread.size() == 5);
+    }
+
+    ::std::vector<::std::string> contents(filenames.size());
+    ::std::vector<::std::error_code> errors(filenames.size());
+    ::std::size_t calls{ 0 };
+    ::xrn::File::loadMany(filenames, [&](
+        ::std::size_t index
+        , ::std::string content
+        , ::std::error_code error
+    ){
+        contents[index] = ::std::move(content);
+        errors[index] = error;
+        ++calls;
+    });
+    REQUIRE(calls == 5);
+    REQUIRE(contents[0] == "first");
+    REQUIRE(contents[1].size() == 300'000);
+    REQUIRE(!errors[3]);
+    REQUIRE(errors[4] == ::std::errc::no_such_file_or_directory);
+}
+
+TEST_CASE(" xrnUtil :: File.LoadMany02")
+{
+    const ::TemporaryDirectory directory{ "File.LoadMany02" };
+
+    ::std::vector<::std::string> filenames;
+    for (auto i{ 0 }; i < 16; ++i) {
+        filenames.push_back(directory.createFile(
+            "LoadMany02_" + ::std::to_string(i), ::std::string(100'000 + i, 'a')
+        ));
+    }
+
+    // thread pool fallback, forced as the test machines have io_uring
+    ::xrn::BatchReader threads{ 4, 2, false };
+    REQUIRE(!threads.isUsingIoUring());
+    ::std::vector<::std::size_t> sizes(filenames.size());
+    threads.read(filenames, [&](::std::size_t index, ::std::string content, ::std::error_code error){
+        REQUIRE(!error);
+        sizes[index] = content.size();
+    });
+    for (auto i{ 0uz }; i < sizes.size(); ++i) {
+        REQUIRE(sizes[i] == 100'000 + i);
+    }
+
+    // reads still in flight when the callback throws are waited for
+    for (auto isIoUringAllowed : { true, false }) {
+        ::xrn::BatchReader reader{ 4, 2, isIoUringAllowed };
+        REQUIRE_THROWS_AS(
+            reader.read(filenames, [](::std::size_t, ::std::string, ::std::error_code){
+                throw ::std::runtime_error{ "stop" };
+            })
+            , ::std::runtime_error
+        );
+    }
+}
+
+TEST_CASE(" xrnUtil :: File.LineIndex01")
+{
+    const ::TemporaryDirectory directory{ "File.LineIndex01" };
+
+    ::std::string content;
+    for (auto i{ 0uz }; i < 1000; ++i) {
+        content += ::std::string(i % 300, 'x') + ::std::to_string(i) + ((i % 7) ? "\n" : "\r\n");
+    }
+    content += "last";
+    const auto filepath{ directory.createFile("LineIndex01", content) };
+
+    const auto table{ ::xrn::File::getLineTable(filepath) };
+    {
+        const auto index{ ::xrn::File::getLineIndex(filepath) };
+        REQUIRE(::std::filesystem::exists(index.getIndexFilename()));
+        REQUIRE(index.size() == table.size());
+        for (auto i{ 0uz }; i < table.size(); ++i) {
+            REQUIRE(index.getLine(i) == table[i]);
+        }
+        REQUIRE(index.getLine(1000) == "last");
+        REQUIRE(index.isUpToDate());
+        REQUIRE_THROWS_AS(index.getLine(1001), ::std::out_of_range);
+    }
+
+    // reloaded from the sidecar
+    const auto indexTime{ ::std::filesystem::last_write_time(filepath + ".lidx") };
+    ::xrn::LineIndex index{ filepath };
+    REQUIRE(::std::filesystem::last_write_time(filepath + ".lidx") == indexTime);
+    REQUIRE(index.getLine(999) == ::std::string(999 % 300, 'x') + "999");
+
+    // invalidated by a modification
+    directory.createFile("LineIndex01", "first\nsecond\n");
+    REQUIRE(!index.isUpToDate());
+    REQUIRE(index.refresh());
+    REQUIRE(index.size() == 2);
+    REQUIRE(index.getLine(1) == "second");
+    REQUIRE(!index.refresh());
+
+    directory.createFile("LineIndex01", "");
+    REQUIRE(::xrn::LineIndex{ filepath }.empty());
+}
+
+TEST_CASE(" xrnUtil :: File.LineIndex02")
+{
+    const ::TemporaryDirectory directory{ "File.LineIndex02" };
+
+    const auto corrupt{ [](const ::std::string& indexFilepath, ::std::size_t offset, ::std::string_view bytes){
+        auto content{ ::xrn::File::getContent(indexFilepath) };
+        content.replace(offset, bytes.size(), bytes);
+        ::std::ofstream{ indexFilepath, ::std::ios::binary | ::std::ios::trunc } << content;
+    } };
+
+    // a line count beyond what the file size allows is rejected and the
+    // index rebuilt
+    const auto smallFilepath{ directory.createFile("LineIndex02.small", "a\n") };
+    ::xrn::LineIndex::build(smallFilepath);
+    const ::std::uint64_t offsetCount{ 60 };
+    corrupt(
+        smallFilepath + ".lidx"
+        , 32 // after the magic, file size and modification time
+        , ::std::string_view{ reinterpret_cast<const char*>(&offsetCount), sizeof(offsetCount) }
+    );
+    REQUIRE(::xrn::LineIndex{ smallFilepath }.size() == 1);
+
+    // varints running past the end of the mapping are not read
+    ::std::string content;
+    for (auto i{ 0uz }; i < 200; ++i) {
+        content += ::std::to_string(i) + "\n";
+    }
+    const auto filepath{ directory.createFile("LineIndex02", content) };
+    ::xrn::LineIndex::build(filepath);
+    corrupt(filepath + ".lidx", ::std::filesystem::file_size(filepath + ".lidx") - 8, ::std::string(8, '\xFF'));
+    ::xrn::LineIndex index{ filepath };
+    REQUIRE(index.getLine(0) == "0");
+    REQUIRE_THROWS_AS(index.getLine(199), ::std::runtime_error);
+
+    // a failed write removes the partial index
+    const auto unwritable{ directory.createFile("LineIndex02.unwritable", content) };
+    const auto handler{ ::std::signal(SIGXFSZ, SIG_IGN) };
+    ::rlimit limit;
+    ::getrlimit(RLIMIT_FSIZE, &limit);
+    ::rlimit smallLimit{ 16, limit.rlim_max };
+    ::setrlimit(RLIMIT_FSIZE, &smallLimit);
+    REQUIRE_THROWS_AS(::xrn::LineIndex::build(unwritable), ::std::system_error);
+    ::setrlimit(RLIMIT_FSIZE, &limit);
+    ::std::signal(SIGXFSZ, handler);
+
+    // no temporary file is left
+    for (const auto& entry : ::std::filesystem::directory_iterator{ directory.getPath() }) {
+        REQUIRE(!entry.path().filename().string().ends_with(".tmp"));
+    }
+}
+
+TEST_CASE(" xrnUtil :: File.Csv01")
+{
+    const ::TemporaryDirectory directory{ "File.Csv01" };
+
+    const auto filepath{ directory.createFile(
+        "Csv01"
+        , "name,value,comment\r\n"
+          "plain,1,\r\n"
+          "\n"
+          "\"quoted, with separator\",2,\"multi\nline\"\n"
+          "\"escaped \"\"quotes\"\"\",,\"\"\n"
+          "last,\"unterminated"
+    ) };
+
+    ::std::vector<::std::vector<::std::string>> records;
+    for (auto fields : ::xrn::File::csv(filepath)) {
+        records.emplace_back(fields.begin(), fields.end());
+    }
+    REQUIRE(records.size() == 5);
+    REQUIRE(records[0] == ::std::vector<::std::string>{ "name", "value", "comment" });
+    REQUIRE(records[1] == ::std::vector<::std::string>{ "plain", "1", "" });
+    REQUIRE(records[2] == ::std::vector<::std::string>{ "quoted, with separator", "2", "multi\nline" });
+    REQUIRE(records[3] == ::std::vector<::std::string>{ "escaped \"quotes\"", "", "" });
+    REQUIRE(records[4] == ::std::vector<::std::string>{ "last", "unterminated" });
+
+    const auto tsvPath{ directory.createFile("Csv01.tsv", "a\tb,c\n1\t2") };
+    ::xrn::CsvReader tsv{ tsvPath, '\t' };
+    REQUIRE(tsv.next());
+    REQUIRE(tsv.getFields().size() == 2);
+    REQUIRE(tsv.getFields()[1] == "b,c");
+    REQUIRE(tsv.next());
+    REQUIRE(tsv.getFields()[1] == "2");
+    REQUIRE(!tsv.next());
+
+    REQUIRE(::xrn::File::csv(directory.createFile("Csv01.empty", "")).begin() == ::std::default_sentinel);
+}
+
+TEST_CASE(" xrnUtil :: File.Csv02")
+{
+    const ::TemporaryDirectory directory{ "File.Csv02" };
+
+    // several unescaped fields in one record, and more than in the previous
+    // record so the buffers grow while fields already point to them
+    const auto filepath{ directory.createFile(
+        "Csv02"
+        , "\"x\"\"0\"\n"
+          "a,\"x\"\"1\",\"y\"\"2\",\"z\"\"3\"\n"
+          "\"a\"\"\",\"b\"\"\",\"c\"\"\",\"d\"\"\",\"e\"\"\",\"f\"\"\",\"g\"\"\",\"h\"\"\",\"i\"\"\",\"j\"\"\"\n"
+    ) };
+
+    ::std::vector<::std::vector<::std::string>> records;
+    for (auto fields : ::xrn::File::csv(filepath)) {
+        records.emplace_back(fields.begin(), fields.end());
+    }
+    REQUIRE(records.size() == 3);
+    REQUIRE(records[0] == ::std::vector<::std::string>{ "x\"0" });
+    REQUIRE(records[1] == ::std::vector<::std::string>{ "a", "x\"1", "y\"2", "z\"3" });
+    REQUIRE(records[2] == ::std::vector<::std::string>{
+        "a\"", "b\"", "c\"", "d\"", "e\"", "f\"", "g\"", "h\"", "i\"", "j\""
+    });
+}
+
+TEST_CASE(" xrnUtil :: File.Chunks01")
+{
+    const ::TemporaryDirectory directory{ "File.Chunks01" };
+
+    ::std::string content;
+    for (auto i{ 0uz }; i < 10'000; ++i) {
+        content += ::std::to_string(i);
+    }
+    const auto filepath{ directory.createFile("Chunks01", content) };
+
+    ::std::string joined;
+    ::std::size_t count{ 0 };
+    for (auto chunk : ::xrn::File::chunks(filepath, 4096)) {
+        REQUIRE(chunk.size() <= 4096);
+        joined += chunk;
+        ++count;
+    }
+    REQUIRE(joined == content);
+    REQUIRE(count == (content.size() + 4095) / 4096);
+
+    ::xrn::File::ChunkReader reader{ filepath, 1000, false };
+    REQUIRE(reader.next());
+    REQUIRE(reader.next());
+    REQUIRE(reader.getOffset() == 1000);
+    REQUIRE(reader.getChunk() == ::std::string_view{ content }.substr(1000, 1000));
+
+    REQUIRE(::xrn::File::chunks(directory.createFile("Chunks01.empty", "")).begin() == ::std::default_sentinel);
+    REQUIRE_THROWS_AS(::xrn::File::chunks(filepath + ".missing"), ::std::system_error);
+}
+
+TEST_CASE(" xrnUtil :: File.Writer01")
+{
+    const ::TemporaryDirectory directory{ "File.Writer01" };
+
+    const auto filepath{ directory.createFile("Writer01", "previous") };
+    const ::std::string big(100'000, 'b');
+    {
+        ::xrn::File::Writer writer{ filepath, ::xrn::File::Writer::Mode::truncate, 16, 1 << 20 };
+        writer.write("small ");
+        writer.write(::std::string_view{ "filling the buffer " });
+        writer.write(big);
+        writer.write(::std::array<::std::string_view, 3>{ " a", "=", "b" });
+        writer.write(::std::as_bytes(::std::span{ "!", 1 }));
+        REQUIRE(writer.getWrittenSize() == 6 + 19 + big.size() + 5);
+    }
+    REQUIRE(::xrn::File::getContent(filepath) == "small filling the buffer " + big + " a=b!");
+
+    {
+        ::xrn::File::Writer writer{ filepath, ::xrn::File::Writer::Mode::append };
+        writer.write("\nappended");
+        writer.commit();
+        REQUIRE(!writer.isOpen());
+    }
+    REQUIRE(::xrn::File::getContent(filepath).ends_with("!\nappended"));
+}
+
+TEST_CASE(" xrnUtil :: File.Writer02")
+{
+    const ::TemporaryDirectory directory{ "File.Writer02" };
+
+    const auto filepath{ directory.createFile("Writer02", "previous") };
+    const auto countFiles{ [&]{
+        return ::std::ranges::distance(::std::filesystem::directory_iterator{
+            ::std::filesystem::path{ filepath }.parent_path()
+        });
+    } };
+    const auto fileCount{ countFiles() };
+    {
+        ::xrn::File::Writer writer{ filepath, ::xrn::File::Writer::Mode::atomic };
+        writer.write("discarded");
+        writer.flush();
+        REQUIRE(::xrn::File::getContent(filepath) == "previous");
+    }
+    REQUIRE(::xrn::File::getContent(filepath) == "previous");
+    REQUIRE(countFiles() == fileCount);
+
+    ::xrn::File::Writer writer{ filepath, ::xrn::File::Writer::Mode::atomic };
+    writer.write("replaced");
+    REQUIRE(::xrn::File::getContent(filepath) == "previous");
+    writer.commit();
+    REQUIRE(::xrn::File::getContent(filepath) == "replaced");
+    REQUIRE(countFiles() == fileCount);
+
+    // the permissions of the replaced file are kept
+    using ::std::filesystem::perms;
+    ::std::filesystem::permissions(filepath, perms::owner_read | perms::owner_write);
+    ::xrn::File::Writer secret{ filepath, ::xrn::File::Writer::Mode::atomic };
+    secret.write("secret");
+    secret.commit();
+    REQUIRE(::xrn::File::getContent(filepath) == "secret");
+    REQUIRE(::std::filesystem::status(filepath).permissions() == (perms::owner_read | perms::owner_write));
+
+    // a new file gets the default permissions, less the umask
+    const auto created{ ::std::filesystem::path{ filepath }.replace_extension("created").string() };
+    const auto mask{ ::umask(022) };
+    ::xrn::File::Writer fresh{ created, ::xrn::File::Writer::Mode::atomic };
+    fresh.commit();
+    ::umask(mask);
+    REQUIRE(::std::filesystem::status(created).permissions() == static_cast<perms>(0644));
+}
+
+TEST_CASE(" xrnUtil :: File.Writer03")
+{
+    const ::TemporaryDirectory directory{ "File.Writer03" };
+
+    // a write failing halfway keeps what is left of the buffer, and only
+    // that, for the next flush
+    const auto filepath{ directory.createFile("Writer03", "") };
+    ::xrn::File::Writer writer{ filepath, ::xrn::File::Writer::Mode::truncate, 16 };
+    writer.write("0123456789");
+
+    const auto handler{ ::std::signal(SIGXFSZ, SIG_IGN) };
+    ::rlimit limit;
+    ::getrlimit(RLIMIT_FSIZE, &limit);
+    ::rlimit smallLimit{ 30, limit.rlim_max };
+    ::setrlimit(RLIMIT_FSIZE, &smallLimit);
+    REQUIRE_THROWS_AS(writer.write(::std::string(100, 'b')), ::std::system_error);
+    ::setrlimit(RLIMIT_FSIZE, &limit);
+    ::std::signal(SIGXFSZ, handler);
+    REQUIRE(writer.getWrittenSize() == 30);
+
+    writer.write("end");
+    writer.commit();
+    REQUIRE(::xrn::File::getContent(filepath) == "0123456789" + ::std::string(20, 'b') + "end");
+}
+
+TEST_CASE(" xrnUtil :: File.Copy01")
+{
+    const ::TemporaryDirectory directory{ "File.Copy01" };
+
+    ::std::string content;
+    for (auto i{ 0uz }; i < 300'000; ++i) {
+        content += ::std::to_string(i);
+    }
+    const auto source{ directory.createFile("Copy01", content) };
+    const auto destination{ directory.createFile("Copy01.copy", "previous content to be replaced entirely") };
+
+    REQUIRE(::xrn::File::copy(source, destination) == content.size());
+    REQUIRE(::xrn::File::getContent(destination) == content);
+    REQUIRE_THROWS_AS(::xrn::File::copy(source, source), ::std::system_error);
+    REQUIRE(::xrn::File::getContent(source) == content);
+    REQUIRE_THROWS_AS(::xrn::File::copy(source + ".missing", destination), ::std::system_error);
+
+    // procfs reports a size of 0
+    REQUIRE(::xrn::File::copy("/proc/self/status", destination) > 0);
+    REQUIRE(::xrn::File::getContent(destination).starts_with("Name:"));
+}
+
+TEST_CASE(" xrnUtil :: File.Transfer01")
+{
+    const ::TemporaryDirectory directory{ "File.Transfer01" };
+
+    const auto source{ directory.createFile("Transfer01", "skipped|transferred") };
+    const auto destination{ directory.createFile("Transfer01.copy", "") };
+
+    ::xrn::FileDescriptor input{ source, O_RDONLY };
+    ::xrn::FileDescriptor output{ destination, O_WRONLY };
+    REQUIRE(::lseek(input.get(), 8, SEEK_SET) == 8);
+    REQUIRE(::xrn::File::transfer(input.get(), output.get()) == 11);
+    REQUIRE(::xrn::File::getContent(destination) == "transferred");
+
+    // through a pipe
+    int pipe[2];
+    REQUIRE(::pipe(pipe) == 0);
+    ::xrn::FileDescriptor pipeOutput{ pipe[0] };
+    ::xrn::FileDescriptor pipeInput{ pipe[1] };
+    REQUIRE(::write(pipeInput.get(), "piped", 5) == 5);
+    pipeInput.close();
+    REQUIRE(::xrn::File::transfer(pipeOutput.get(), output.get()) == 5);
+    REQUIRE(::xrn::File::getContent(destination) == "transferredpiped");
+}
+
+TEST_CASE(" xrnUtil :: File.Pmr01")
+{
+    const ::TemporaryDirectory directory{ "File.Pmr01" };
+
+    const auto filepath{ directory.createFile("Pmr01", "a first line long enough to be allocated\r\nsecond\nthird") };
+
+    // every allocation must come from the arena, the upstream throws
+    ::std::array<::std::byte, 16 * 1024> arena;
+    ::std::pmr::monotonic_buffer_resource resource{ arena.data(), arena.size(), ::std::pmr::null_memory_resource() };
+
+    const auto content{ ::xrn::File::getContent(filepath, &resource) };
+    REQUIRE(::std::string_view{ content } == ::xrn::File::getContent(filepath));
+    REQUIRE(content.get_allocator().resource() == &resource);
+
+    const auto lines{ ::xrn::File::getContentAsVector(filepath, &resource) };
+    REQUIRE(lines.size() == 3);
+    REQUIRE(lines[0] == "a first line long enough to be allocated");
+    REQUIRE(lines[2] == "third");
+    REQUIRE(lines[0].get_allocator().resource() == &resource);
+
+    ::std::pmr::string reloaded{ &resource };
+    ::xrn::File::readInto("/proc/self/status", reloaded);
+    REQUIRE(reloaded.starts_with("Name:"));
+
+    REQUIRE(::xrn::File::getContentAsVector(filepath + ".missing", &resource).empty());
+    REQUIRE_THROWS_AS(::xrn::File::getContent(filepath + ".missing", &resource), ::std::system_error);
+}
+
+TEST_CASE(" xrnUtil :: File.Expected01")
+{
+    const ::TemporaryDirectory directory{ "File.Expected01" };
+
+    const auto filepath{ directory.createFile("Expected01", "first\r\nsecond\n\nfourth") };
+
+    const auto content{ ::xrn::File::tryGetContent(filepath) };
+    REQUIRE(content.has_value());
+    REQUIRE(*content == ::xrn::File::getContent(filepath));
+
+    const auto lines{ ::xrn::File::tryGetContentAsVector(filepath) };
+    REQUIRE(lines.has_value());
+    REQUIRE(*lines == ::xrn::File::getContentAsVector(filepath));
+    REQUIRE(lines->size() == 4);
+    REQUIRE((*lines)[0] == "first");
+    REQUIRE((*lines)[2].empty());
+
+    ::std::string reused;
+    REQUIRE(::xrn::File::tryReadInto("/proc/self/status", reused).has_value());
+    REQUIRE(reused.starts_with("Name:"));
+
+    const auto missing{ ::xrn::File::tryGetContent(filepath + ".missing") };
+    REQUIRE(!missing.has_value());
+    REQUIRE(missing.error() == ::std::errc::no_such_file_or_directory);
+    REQUIRE(::xrn::File::tryGetContentAsVector(filepath + ".missing").error() == ::std::errc::no_such_file_or_directory);
+    REQUIRE(::xrn::File::tryReadInto("/", reused).error() == ::std::errc::is_a_directory);
+}
+
+TEST_CASE(" xrnUtil :: File.ScanDirectory01")
+{
+    const ::TemporaryDirectory directory{ "File.ScanDirectory01" };
+    const auto& root{ directory.getPath() };
+    ::std::filesystem::create_directories(root / "a" / "b");
+    ::std::filesystem::create_directories(root / "empty");
+    ::std::ofstream{ root / "a" / "b" / "deep.txt" } << "deep";
+    ::std::ofstream{ root / "a" / "image.png" } << "png";
+    ::std::ofstream{ root / "top.txt" } << "top content";
+    ::std::filesystem::create_directory_symlink(root / "a", root / "linkedDirectory");
+    ::std::filesystem::create_symlink(root / "top.txt", root / "linked.txt");
+
+    const auto entries{ ::xrn::File::scanDirectory(root.string(), [](::std::string_view path){
+        return path.ends_with(".txt");
+    }) };
+    REQUIRE(entries.size() == 3);
+    REQUIRE(entries[0].path == (root / "a" / "b" / "deep.txt").string());
+    REQUIRE(entries[0].size == 4);
+    REQUIRE(entries[1].path == (root / "linked.txt").string());
+    REQUIRE(entries[1].size == 11);
+    REQUIRE(entries[2].path == (root / "top.txt").string());
+
+    REQUIRE(::xrn::File::scanDirectory(root.string() + "/", [](auto){ return true; }).size() == 4);
+    REQUIRE(::xrn::DirectoryScanner{ 1 }.scan(root.string(), [](auto){ return true; }).size() == 4);
+    REQUIRE_THROWS_AS(::xrn::File::scanDirectory((root / "top.txt").string(), [](auto){ return true; }), ::std::system_error);
+    REQUIRE_THROWS_AS(::xrn::File::scanDirectory(root.string(), [](auto) -> bool { throw ::std::runtime_error{ "filter" }; }), ::std::runtime_error);
+
+    ::std::map<::std::string, ::std::string> contents;
+    ::xrn::File::loadDirectory(root.string(), [](::std::string_view path){
+        return !path.ends_with(".png");
+    }, [&](const ::xrn::File::DirectoryEntry& entry, ::std::string content, ::std::error_code error){
+        REQUIRE(!error);
+        contents[entry.path] = ::std::move(content);
+    });
+    REQUIRE(contents.size() == 3);
+    REQUIRE(contents[(root / "top.txt").string()] == "top content");
+    REQUIRE(contents[(root / "a" / "b" / "deep.txt").string()] == "deep");
+}
+
+TEST_CASE(" xrnUtil :: File.ScanDirectory02")
+{
+    const ::TemporaryDirectory directory{ "File.ScanDirectory02" };
+
+    // more files than requests in flight at once
+    for (auto i{ 0uz }; i < 200; ++i) {
+        directory.createFile(::fmt::format("{:03}", i), ::std::string(i, 'x'));
+    }
+    const auto scan{ [&](::xrn::DirectoryScanner scanner){
+        return scanner.scan(directory.getPath().string(), [](::std::string_view path){
+            return !path.ends_with('7');
+        });
+    } };
+
+    ::xrn::DirectoryScanner withoutIoUring{ 2, false };
+    REQUIRE(!withoutIoUring.isUsingIoUring());
+    const auto entries{ scan(withoutIoUring) };
+    REQUIRE(entries.size() == 180);
+    for (const auto& entry : entries) {
+        REQUIRE(entry.size == ::std::stoul(::std::filesystem::path{ entry.path }.filename().string()));
+    }
+
+    const auto batched{ scan(::xrn::DirectoryScanner{ 2 }) };
+    REQUIRE(batched.size() == entries.size());
+    for (auto i{ 0uz }; i < entries.size(); ++i) {
+        REQUIRE(batched[i].path == entries[i].path);
+        REQUIRE(batched[i].size == entries[i].size);
+    }
+}
+
+TEST_CASE(" xrnUtil :: File.Binary01")
+{
+    const ::TemporaryDirectory directory{ "File.Binary01" };
+
+    const auto filepath{ directory.createFile("Binary01", "0123456789abcdefghijklmnopqrstuvwxyz") };
+
+    for (const auto alignment : { 1uz, 16uz, 64uz, 4096uz }) {
+        const auto buffer{ ::xrn::File::getBinary(filepath, alignment) };
+        REQUIRE(buffer.getView() == "0123456789abcdefghijklmnopqrstuvwxyz");
+        REQUIRE(buffer.getAlignment() == alignment);
+        REQUIRE(reinterpret_cast<::std::uintptr_t>(buffer.data()) % alignment == 0);
+        REQUIRE(buffer.getPadding() >= alignment);
+        REQUIRE((buffer.size() + buffer.getPadding()) % alignment == 0);
+        const ::std::span padding{ buffer.data() + buffer.size(), buffer.getPadding() };
+        REQUIRE(::std::ranges::all_of(padding, [](auto byte){ return byte == ::std::byte{ 0 }; }));
+    }
+
+    // size reported as 0, read until the end with reallocations
+    const auto status{ ::xrn::File::getBinary("/proc/self/status", 48) };
+    REQUIRE(status.getView().starts_with("Name:"));
+    REQUIRE(status.getAlignment() == 64);
+    REQUIRE(reinterpret_cast<::std::uintptr_t>(status.data()) % 64 == 0);
+    REQUIRE(status.data()[status.size()] == ::std::byte{ 0 });
+
+    const auto empty{ ::xrn::File::getBinary(directory.createFile("Binary01Empty", "")) };
+    REQUIRE(empty.empty());
+    REQUIRE(empty.data() != nullptr);
+    REQUIRE(empty.getPadding() >= ::xrn::AlignedBuffer::defaultAlignment);
+
+    auto moved{ ::xrn::File::getBinary(filepath) };
+    ::xrn::AlignedBuffer other{ ::std::move(moved) };
+    REQUIRE(moved.empty());
+    REQUIRE(other.size() == 36);
+    other.resize(4);
+    REQUIRE(other.getView() == "0123");
+    REQUIRE(other.data()[4] == ::std::byte{ 0 });
+
+    REQUIRE_THROWS_AS(::xrn::File::getBinary(filepath + ".missing"), ::std::system_error);
+}
+
+TEST_CASE(" xrnUtil :: File.Decompress01")
+{
+    const ::TemporaryDirectory directory{ "File.Decompress01" };
+
+    ::std::string content;
+    for (auto i{ 0 }; i < 100'000; ++i) {
+        content += ::fmt::format("line {} of the decompressed content\n", i);
+    }
+
+    const auto check{ [&](const ::std::string& filepath, ::std::string_view expected){
+        ::std::string decompressed;
+        for (auto chunk : ::xrn::File::decompress(filepath, 64 * 1024)) {
+            decompressed += chunk;
+        }
+        REQUIRE(decompressed == expected);
+
+        ::std::string joined;
+        for (auto line : ::xrn::File::decompressedLines(filepath)) {
+            joined += line;
+            joined += '\n';
+        }
+        REQUIRE(joined == expected);
+    } };
+
+    const auto plain{ directory.createFile("Decompress01", content) };
+    REQUIRE(::xrn::File::decompress(plain).getCodec() == ::xrn::DecompressingReader::Codec::none);
+    check(plain, content);
+
+#ifdef XRN_DECOMPRESSING_READER_ZLIB
+    {
+        ::z_stream stream{};
+        REQUIRE(::deflateInit2(&stream, 6, Z_DEFLATED, MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+        ::std::string compressed(::deflateBound(&stream, static_cast<::uLong>(content.size())), '\0');
+        stream.next_in = reinterpret_cast<::Bytef*>(content.data());
+        stream.avail_in = static_cast<::uInt>(content.size());
+        stream.next_out = reinterpret_cast<::Bytef*>(compressed.data());
+        stream.avail_out = static_cast<::uInt>(compressed.size());
+        REQUIRE(::deflate(&stream, Z_FINISH) == Z_STREAM_END);
+        compressed.resize(stream.total_out);
+        ::deflateEnd(&stream);
+
+        const auto filepath{ directory.createFile("Decompress01.gz", compressed) };
+        REQUIRE(::xrn::File::decompress(filepath).getCodec() == ::xrn::DecompressingReader::Codec::gzip);
+        check(filepath, content);
+
+        // concatenated members, as produced by cat a.gz b.gz
+        check(directory.createFile("Decompress01Twice.gz", compressed + compressed), content + content);
+
+        const auto truncated{ directory.createFile("Decompress01Truncated.gz", compressed.substr(0, compressed.size() / 2)) };
+        REQUIRE_THROWS_AS(check(truncated, content), ::std::system_error);
+
+        // the error comes from the background thread and ends the range
+        ::xrn::DecompressingReader reader{ truncated, 4 * 1024 };
+        REQUIRE(reader.next());
+        REQUIRE_THROWS_AS([&]{ while (reader.next()) {} }(), ::std::system_error);
+        REQUIRE_FALSE(reader.next());
+        REQUIRE(reader.begin() == reader.end());
+    }
+#endif // XRN_DECOMPRESSING_READER_ZLIB
+
+#ifdef XRN_DECOMPRESSING_READER_ZSTD
+    {
+        ::std::string compressed(::ZSTD_compressBound(content.size()), '\0');
+        compressed.resize(::ZSTD_compress(compressed.data(), compressed.size(), content.data(), content.size(), 3));
+
+        const auto filepath{ directory.createFile("Decompress01.zst", compressed) };
+        REQUIRE(::xrn::File::decompress(filepath).getCodec() == ::xrn::DecompressingReader::Codec::zstd);
+        check(filepath, content);
+        check(directory.createFile("Decompress01Twice.zst", compressed + compressed), content + content);
+
+        const auto corrupted{ directory.createFile("Decompress01Corrupted.zst", compressed.substr(0, 8) + ::std::string(64, 'x')) };
+        REQUIRE_THROWS_AS(check(corrupted, content), ::std::system_error);
+    }
+#endif // XRN_DECOMPRESSING_READER_ZSTD
+
+#ifdef XRN_DECOMPRESSING_READER_LZ4
+    {
+        ::std::string compressed(::LZ4F_compressFrameBound(content.size(), nullptr), '\0');
+        compressed.resize(::LZ4F_compressFrame(compressed.data(), compressed.size(), content.data(), content.size(), nullptr));
+
+        const auto filepath{ directory.createFile("Decompress01.lz4", compressed) };
+        REQUIRE(::xrn::File::decompress(filepath).getCodec() == ::xrn::DecompressingReader::Codec::lz4);
+        check(filepath, content);
+
+        const auto truncated{ directory.createFile("Decompress01Truncated.lz4", compressed.substr(0, compressed.size() - 4)) };
+        REQUIRE_THROWS_AS(check(truncated, content), ::std::system_error);
+    }
+#endif // XRN_DECOMPRESSING_READER_LZ4
+}
@@ -0,0 +1,58 @@
+#include <pch.hpp>
+#include <catch2/catch.hpp>
+#include <xrn/Util/FileCache.hpp>
+#include "TemporaryDirectory.hpp"
+
+TEST_CASE(" xrnUtil :: FileCache.Get01")
+{
+    const ::TemporaryDirectory directory{ "FileCache.Get01" };
+
+    const auto filepath{ directory.createFile("FileCacheGet01", "first") };
+    ::xrn::FileCache cache;
+
+    const auto first{ cache.get(filepath) };
+    REQUIRE(*first == "first");
+    REQUIRE(cache.get(filepath) == first);
+    REQUIRE(cache.getUsedBytes() == 5);
+
+    directory.createFile("FileCacheGet01", "second");
+    const auto second{ cache.get(filepath) };
+    REQUIRE(*second == "second");
+    REQUIRE(*first == "first");
+    REQUIRE(cache.size() == 1);
+    REQUIRE(cache.getUsedBytes() == 6);
+
+    cache.invalidate(filepath);
+    REQUIRE(!cache.contains(filepath));
+    REQUIRE(cache.getUsedBytes() == 0);
+
+    REQUIRE_THROWS_AS(cache.get(filepath + ".missing"), ::std::system_error);
+}
+
+TEST_CASE(" xrnUtil :: FileCache.Budget01")
+{
+    const ::TemporaryDirectory directory{ "FileCache.Budget01" };
+
+    const auto a{ directory.createFile("FileCacheBudget01a", "aaaa") };
+    const auto b{ directory.createFile("FileCacheBudget01b", "bbbb") };
+    const auto c{ directory.createFile("FileCacheBudget01c", "cccc") };
+    const auto big{ directory.createFile("FileCacheBudget01d", "dddddddddddd") };
+    ::xrn::FileCache cache{ 10 };
+
+    (void)cache.get(a);
+    (void)cache.get(b);
+    (void)cache.get(a);
+    (void)cache.get(c);
+    REQUIRE(cache.contains(a));
+    REQUIRE(!cache.contains(b));
+    REQUIRE(cache.contains(c));
+    REQUIRE(cache.getUsedBytes() == 8);
+
+    REQUIRE(*cache.get(big) == "dddddddddddd");
+    REQUIRE(!cache.contains(big));
+    REQUIRE(cache.size() == 2);
+
+    cache.setBudget(4);
+    REQUIRE(cache.size() == 1);
+    REQUIRE(cache.contains(c));
+}
@@ -0,0 +1,61 @@
+#include <pch.hpp>
+#include <catch2/catch.hpp>
+#include <xrn/Util/File.hpp>
+#include "TemporaryDirectory.hpp"
+
+TEST_CASE(" xrnUtil :: FileFollower.Follow01")
+{
+    const ::TemporaryDirectory directory{ "FileFollower.Follow01" };
+
+    const auto filepath{ directory.createFile("FileFollowerFollow01", "old\n") };
+    auto follower{ ::xrn::File::follow(filepath) };
+    REQUIRE(follower.getOffset() == 4);
+    REQUIRE(!follower.next(0));
+
+    directory.createFile("FileFollowerFollow01", "first\r\nsec", ::std::ios::app);
+    REQUIRE(follower.next(1000));
+    REQUIRE(follower.getLine() == "first");
+    REQUIRE(!follower.next(20));
+    directory.createFile("FileFollowerFollow01", "ond\n", ::std::ios::app);
+    REQUIRE(follower.next(1000));
+    REQUIRE(follower.getLine() == "second");
+    REQUIRE(follower.getOffset() == 18);
+
+    // rotated through a rename, the unterminated end of the old file is kept
+    directory.createFile("FileFollowerFollow01", "last", ::std::ios::app);
+    ::std::filesystem::rename(filepath, filepath + ".1");
+    REQUIRE(!follower.next(20));
+    directory.createFile("FileFollowerFollow01", "new\n");
+    REQUIRE(follower.next(2000));
+    REQUIRE(follower.getLine() == "last");
+    REQUIRE(follower.next(1000));
+    REQUIRE(follower.getLine() == "new");
+
+    // truncated in place
+    directory.createFile("FileFollowerFollow01", "");
+    directory.createFile("FileFollowerFollow01", "again\n", ::std::ios::app);
+    REQUIRE(follower.next(2000));
+    REQUIRE(follower.getLine() == "again");
+    REQUIRE(follower.getOffset() == 6);
+}
+
+TEST_CASE(" xrnUtil :: FileFollower.Follow02")
+{
+    const ::TemporaryDirectory directory{ "FileFollower.Follow02" };
+
+    const auto filepath{ directory.createFile("FileFollowerFollow02", "a\nb\n") };
+    ::xrn::FileFollower follower{ filepath, true };
+
+    ::std::jthread writer{ [&]{
+        ::std::this_thread::sleep_for(::std::chrono::milliseconds{ 50 });
+        directory.createFile("FileFollowerFollow02", "c\n", ::std::ios::app);
+        ::std::this_thread::sleep_for(::std::chrono::milliseconds{ 50 });
+        follower.stop();
+    } };
+    ::std::vector<::std::string> lines;
+    for (auto line : follower) {
+        lines.emplace_back(line);
+    }
+    REQUIRE(lines == ::std::vector<::std::string>{ "a", "b", "c" });
+    REQUIRE(!follower.next());
+}
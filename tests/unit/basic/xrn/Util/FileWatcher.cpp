@@ -0,0 +1,104 @@
+#include <pch.hpp>
+#include <catch2/catch.hpp>
+#include <xrn/Util/FileWatcher.hpp>
+#include "TemporaryDirectory.hpp"
+
+TEST_CASE(" xrnUtil :: FileWatcher.Watch01")
+{
+    const ::TemporaryDirectory directory{ "FileWatcher.Watch01" };
+
+    const auto filepath{ directory.createFile("FileWatcherWatch01", "first\n") };
+    ::xrn::FileWatcher watcher;
+    ::std::vector<::std::tuple<::std::string, ::std::size_t, bool>> changes;
+    watcher.watch(filepath, [&](const ::xrn::FileWatcher::Change& change){
+        changes.emplace_back(change.content, change.offset, change.isAppended);
+    });
+    REQUIRE(watcher.isWatched(filepath));
+    REQUIRE(watcher.poll() == 0);
+
+    directory.createFile("FileWatcherWatch01", "second\n", ::std::ios::app);
+    REQUIRE(watcher.poll(1000) == 1);
+    REQUIRE(changes.size() == 1);
+    REQUIRE(changes.back() == ::std::tuple{ "second\n", 6, true });
+
+    directory.createFile("FileWatcherWatch01", "rewritten\n");
+    watcher.poll(1000);
+    REQUIRE(::std::get<0>(changes.back()) == "rewritten\n");
+    REQUIRE(!::std::get<2>(changes.back()));
+
+    // replaced through a rename
+    const auto replacement{ directory.createFile("FileWatcherWatch01.tmp", "replaced\n") };
+    ::std::filesystem::rename(replacement, filepath);
+    watcher.poll(1000);
+    REQUIRE(::std::get<0>(changes.back()) == "replaced\n");
+
+    directory.createFile("FileWatcherWatch01", "more\n", ::std::ios::app);
+    watcher.poll(1000);
+    REQUIRE(changes.back() == ::std::tuple{ "more\n", 9, true });
+
+    watcher.unwatch(filepath);
+    REQUIRE(!watcher.isWatched(filepath));
+    REQUIRE_THROWS_AS(watcher.watch(filepath + ".missing", [](const auto&){}), ::std::system_error);
+}
+
+TEST_CASE(" xrnUtil :: FileWatcher.Watch02")
+{
+    const ::TemporaryDirectory directory{ "FileWatcher.Watch02" };
+
+    // moved away then created again, as logrotate does
+    const auto filepath{ directory.createFile("FileWatcherWatch02", "first\n") };
+    ::xrn::FileWatcher watcher;
+    ::std::vector<::std::tuple<::std::string, ::std::size_t, bool>> changes;
+    watcher.watch(filepath, [&](const ::xrn::FileWatcher::Change& change){
+        changes.emplace_back(change.content, change.offset, change.isAppended);
+    });
+
+    ::std::filesystem::rename(filepath, filepath + ".1");
+    watcher.poll(1000);
+    REQUIRE(watcher.isWatched(filepath));
+
+    directory.createFile("FileWatcherWatch02", "recreated\n");
+    for (auto i{ 0 }; i < 10 && (changes.empty() || ::std::get<0>(changes.back()) != "recreated\n"); ++i) {
+        watcher.poll(100);
+    }
+    REQUIRE(!changes.empty());
+    REQUIRE(::std::get<0>(changes.back()) == "recreated\n");
+    REQUIRE(!::std::get<2>(changes.back()));
+
+    directory.createFile("FileWatcherWatch02", "more\n", ::std::ios::app);
+    watcher.poll(1000);
+    REQUIRE(changes.back() == ::std::tuple{ "more\n", 10, true });
+
+    // removed then created again
+    ::std::filesystem::remove(filepath);
+    watcher.poll(1000);
+    REQUIRE(watcher.isWatched(filepath));
+    directory.createFile("FileWatcherWatch02", "again\n");
+    for (auto i{ 0 }; i < 10 && ::std::get<0>(changes.back()) != "again\n"; ++i) {
+        watcher.poll(100);
+    }
+    REQUIRE(::std::get<0>(changes.back()) == "again\n");
+
+    watcher.unwatch(filepath);
+    REQUIRE(!watcher.isWatched(filepath));
+}
+
+TEST_CASE(" xrnUtil :: FileWatcher.Watch03")
+{
+    const ::TemporaryDirectory directory{ "FileWatcher.Watch03" };
+
+    // rewritten in place with the same size and the same tail
+    const auto filepath{ directory.createFile("FileWatcherWatch03", "A" + ::std::string(100, 'x') + "\n") };
+    ::xrn::FileWatcher watcher;
+    ::std::vector<::std::tuple<::std::string, ::std::size_t, bool>> changes;
+    watcher.watch(filepath, [&](const ::xrn::FileWatcher::Change& change){
+        changes.emplace_back(change.content, change.offset, change.isAppended);
+    });
+
+    // past the granularity of the modification time
+    ::std::this_thread::sleep_for(::std::chrono::milliseconds{ 20 });
+    directory.createFile("FileWatcherWatch03", "B" + ::std::string(100, 'x') + "\n");
+    watcher.poll(1000);
+    REQUIRE(!changes.empty());
+    REQUIRE(changes.back() == ::std::tuple{ "B" + ::std::string(100, 'x') + "\n", 0, false });
+}
@@ -0,0 +1,115 @@
+#include <pch.hpp>
+#include <catch2/catch.hpp>
+#include <xrn/Util/ScopedTimer.hpp>
+
+template class ::xrn::util::TimerStats<>;
+template class ::xrn::util::ScopedTimer<"test">;
+
+TEST_CASE(" xrnUtil :: ScopedTimer.Stats01")
+{
+    ::xrn::TimerStats stats;
+    REQUIRE(stats.getCount() == 0);
+    REQUIRE(stats.getMin() == 0);
+    REQUIRE(stats.getMax() == 0);
+    REQUIRE(stats.getVariance() == 0);
+
+    for (auto value : { 2, 4, 4, 4, 5, 5, 7, 9 }) {
+        stats.record(::xrn::util::BasicTime<double>{ value });
+    }
+    REQUIRE(stats.getCount() == 8);
+    REQUIRE(stats.getSum() == 40);
+    REQUIRE(stats.getMin() == 2);
+    REQUIRE(stats.getMax() == 9);
+    REQUIRE(stats.getMean() == 5);
+    REQUIRE(stats.getVariance() == Approx(4));
+    REQUIRE(stats.getStandardDeviation().get() == Approx(2));
+
+    // merged halves give the same result as recorded at once
+    ::xrn::TimerStats first;
+    ::xrn::TimerStats second;
+    for (auto value : { 2, 4, 4 }) {
+        first.record(::xrn::util::BasicTime<double>{ value });
+    }
+    for (auto value : { 4, 5, 5, 7, 9 }) {
+        second.record(::xrn::util::BasicTime<double>{ value });
+    }
+    first.merge(second);
+    first.merge(::xrn::TimerStats{});
+    REQUIRE(first.getCount() == 8);
+    REQUIRE(first.getSum() == 40);
+    REQUIRE(first.getMin() == 2);
+    REQUIRE(first.getMax() == 9);
+    REQUIRE(first.getMean().get() == Approx(5));
+    REQUIRE(first.getVariance() == Approx(4));
+}
+
+TEST_CASE(" xrnUtil :: ScopedTimer.Basic01")
+{
+    struct Tag;
+    using Source = ::xrn::util::clockSource::Manual<Tag>;
+    using Timer = ::xrn::ScopedTimer<"basic", ::xrn::util::BasicClock<::xrn::Time, Source>>;
+    static_assert(Timer::getName() == "basic");
+
+    for (auto value : { 10, 30 }) {
+        Timer timer;
+        Source::advance(::std::chrono::milliseconds{ value });
+        REQUIRE(timer.getElapsed() == value);
+    }
+    Timer::record(::std::chrono::microseconds{ 20'000 });
+
+    const auto stats{ Timer::getSnapshot() };
+    REQUIRE(stats.getCount() == 3);
+    REQUIRE(stats.getSum() == 60);
+    REQUIRE(stats.getMin() == 10);
+    REQUIRE(stats.getMax() == 30);
+    REQUIRE(stats.getMean().get() == Approx(20));
+
+    // other names are other slots
+    REQUIRE(::xrn::ScopedTimer<"other">::getSnapshot().getCount() == 0);
+}
+
+TEST_CASE(" xrnUtil :: ScopedTimer.Thread01")
+{
+    using Timer = ::xrn::ScopedTimer<"thread">;
+    static constexpr auto threadCount{ 4 };
+    static constexpr auto recordCount{ 10'000 };
+
+    ::std::atomic<bool> isDone{ false };
+    ::std::atomic<int> finished{ 0 };
+    ::std::vector<::std::thread> threads;
+    for (auto i{ 0 }; i < threadCount; ++i) {
+        threads.emplace_back([i, &isDone, &finished]{
+            for (auto j{ 0 }; j < recordCount; ++j) {
+                Timer::record(::xrn::Time{ i + 1 });
+            }
+            ++finished;
+            // half the threads stay alive while snapshots are taken
+            while (i % 2 && !isDone) {
+                ::std::this_thread::yield();
+            }
+        });
+    }
+
+    // snapshots taken while recording are consistent
+    while (finished < threadCount) {
+        const auto stats{ Timer::getSnapshot() };
+        REQUIRE(stats.getSum().get() >= stats.getCount());
+        REQUIRE(stats.getSum().get() <= stats.getCount() * threadCount);
+    }
+
+    const auto check{ [](const auto& stats){
+        REQUIRE(stats.getCount() == threadCount * recordCount);
+        REQUIRE(stats.getSum() == recordCount * (1 + 2 + 3 + 4));
+        REQUIRE(stats.getMin() == 1);
+        REQUIRE(stats.getMax() == threadCount);
+        REQUIRE(stats.getMean().get() == Approx(2.5));
+        REQUIRE(stats.getVariance() == Approx(1.25));
+    } };
+    check(Timer::getSnapshot());
+    isDone = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // the finished threads are kept
+    check(Timer::getSnapshot());
+}
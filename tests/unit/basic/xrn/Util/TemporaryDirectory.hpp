@@ -0,0 +1,60 @@
+#pragma once
+
+#include <pch.hpp>
+
+///////////////////////////////////////////////////////////////////////////
+// Directory holding the files of a test case, removed with its content
+// when the test case ends
+///////////////////////////////////////////////////////////////////////////
+class TemporaryDirectory {
+
+public:
+
+    explicit TemporaryDirectory(
+        const ::std::string& name
+    )
+        : m_path{ ::std::filesystem::temp_directory_path() / ("xrnUtilTests_" + name) }
+    {
+        ::std::filesystem::remove_all(m_path);
+        ::std::filesystem::create_directory(m_path);
+    }
+
+    ~TemporaryDirectory()
+    {
+        ::std::error_code error;
+        ::std::filesystem::remove_all(m_path, error);
+    }
+
+    TemporaryDirectory(
+        const TemporaryDirectory& that
+    ) = delete;
+
+    auto operator=(
+        const TemporaryDirectory& that
+    ) -> TemporaryDirectory& = delete;
+
+    // Writes content to a file of the directory and returns its path
+    auto createFile(
+        const ::std::string& name
+        , ::std::string_view content
+        , ::std::ios::openmode mode = ::std::ios::trunc
+    ) const
+        -> ::std::string
+    {
+        auto filepath{ m_path / name };
+        ::std::ofstream file{ filepath, ::std::ios::binary | mode };
+        file.write(content.data(), static_cast<::std::streamsize>(content.size()));
+        return filepath.string();
+    }
+
+    [[ nodiscard ]] auto getPath() const
+        -> const ::std::filesystem::path&
+    {
+        return m_path;
+    }
+
+private:
+
+    ::std::filesystem::path m_path;
+
+};
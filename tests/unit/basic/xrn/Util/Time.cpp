@@ -3,6 +3,7 @@
 #include <xrn/Util/Time.hpp>
 
 template class ::xrn::util::BasicTime<float>;
+template class ::xrn::util::BasicTime<::std::int64_t, ::std::nano>;
 
 using TestingTime = ::xrn::util::BasicTime<float>;
 
@@ -209,3 +210,75 @@ TEST_CASE(" xrnUtil :: Time.litteral01")
     REQUIRE(t3 == tt3);
     REQUIRE(t4 == tt4);
 }
+
+TEST_CASE(" xrnUtil :: Time.Chrono01")
+{
+    const auto t1{ ::TestingTime::createAsMilliseconds(1500) };
+    REQUIRE(t1.getAsChronoSeconds().count() == 1.5f);
+    REQUIRE(t1.getAsChronoMilliseconds().count() == 1500);
+    REQUIRE(t1.getAsChronoMicroseconds().count() == 1500000);
+    REQUIRE(t1.getAsChronoNanoseconds().count() == 1500000000);
+}
+
+TEST_CASE(" xrnUtil :: Time.Nano01")
+{
+    static_assert(::std::is_same_v<::xrn::NanoTime::Period, ::std::nano>);
+    const auto t1{ ::xrn::NanoTime::createAsSeconds(1) };
+    REQUIRE(t1.get() == 1'000'000'000);
+    REQUIRE(t1 == ::xrn::NanoTime::createAsMilliseconds(1000));
+    REQUIRE(t1 == ::xrn::NanoTime::createAsMicroseconds(1000000));
+    REQUIRE(t1 == ::xrn::NanoTime::createAsNanoseconds(1000000000));
+    REQUIRE(::xrn::NanoTime::createAsSeconds(0.5).get() == 500'000'000);
+    REQUIRE(t1.getAsSeconds() == 1);
+    REQUIRE(t1.getAsMilliseconds() == 1000);
+    REQUIRE(t1.getAsMicroseconds() == 1000000);
+    REQUIRE(t1.getAsChronoNanoseconds() == ::std::chrono::seconds{ 1 });
+
+    // exact after days of uptime, a float would round to about 0.5ms
+    auto t2{ ::xrn::NanoTime::createAsSeconds(100 * 3600) };
+    t2 += 1;
+    REQUIRE(t2 - ::xrn::NanoTime::createAsSeconds(100 * 3600) == 1);
+    REQUIRE(t2.getAsNanoseconds() == 360'000'000'000'001);
+    t2 %= ::xrn::NanoTime::createAsSeconds(7);
+    REQUIRE(t2.get() == 360'000'000'000'001 % 7'000'000'000);
+
+    // integral times keep milliseconds unless told otherwise
+    static_assert(::std::is_same_v<::xrn::util::BasicTime<int>::Period, ::std::milli>);
+    REQUIRE(::xrn::util::BasicTime<int>{ 1000 }.getAsSeconds() == 1);
+
+    // other types are converted
+    REQUIRE(::xrn::NanoTime{ ::xrn::Time{ 1.5f } }.get() == 1'500'000);
+    REQUIRE(::xrn::Time{ t1 } == 1000);
+    REQUIRE(t1 + ::xrn::Time{ 1 } == 1'001'000'000);
+    REQUIRE(t1 > ::xrn::Time{ 999 });
+    REQUIRE(::fmt::format("{}", t1) == "1000000000");
+}
+
+TEST_CASE(" xrnUtil :: Time.Unit01")
+{
+    using Microseconds = ::xrn::util::BasicTime<::std::int64_t, ::std::micro>;
+    using Minutes = ::xrn::util::BasicTime<double, ::std::ratio<60>>;
+
+    // folded at compile time
+    static_assert(Microseconds::createAsSeconds(2).get() == 2'000'000);
+    static_assert(Microseconds::createAs<::std::ratio<60>>(1).getAsMilliseconds() == 60'000);
+    static_assert(Minutes::createAsSeconds(90).get() == 1.5);
+    static_assert((Microseconds{ 5 } + ::xrn::NanoTime{ 3'000 }).get() == 8);
+    static_assert(Minutes{ 2 }.getAs<::std::ratio<3600>>() == 2.0 / 60);
+
+    // mixed units
+    const Microseconds t1{ ::xrn::Time{ 1.5f } };
+    REQUIRE(t1.get() == 1'500);
+    REQUIRE(::xrn::NanoTime{ t1 }.get() == 1'500'000);
+    REQUIRE(t1 == ::xrn::Time{ 1.5f });
+    REQUIRE(t1 < Minutes{ 1 });
+    auto t2{ Minutes{ 1 } };
+    t2 -= ::xrn::util::BasicTime<int, ::std::ratio<1>>{ 30 };
+    REQUIRE(t2.get() == 0.5);
+
+    // chrono durations
+    REQUIRE(Microseconds{ ::std::chrono::milliseconds{ 3 } }.get() == 3'000);
+    REQUIRE(Minutes{ ::std::chrono::hours{ 2 } }.get() == 120);
+    REQUIRE((::xrn::Time{ 1 } + ::std::chrono::microseconds{ 500 }).get() == 1.5f);
+    REQUIRE(t1.getAsChronoNanoseconds() == ::std::chrono::microseconds{ 1'500 });
+}